@@ -12,7 +12,7 @@
   Version: 0.0.3
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_FT6206
-  Last Modified: +05:30 08:55:18 AM 28-03-2025, Friday
+  Last Modified: +05:30 01:14:22 AM 17-10-2026, Saturday
  */
 //============================================================================================//
 
@@ -29,7 +29,9 @@
 // Parameters: Width, Height, &Wire, Reset pin, Interrupt pin
 CSE_FT6206 tsPanel = CSE_FT6206 (240, 320, &Wire, FT6206_PIN_RST, FT6206_PIN_INT);
 
-bool intReceived = false; // Flag to indicate that an interrupt has been received
+// Frames read on interrupt are queued here. A buffer of 8 frames holds up to 7 frames.
+CSE_FT6206_Frame frameBuffer [8];
+CSE_FT6206_FrameQueue frameQueue (frameBuffer, 8);
 
 //============================================================================================//
 
@@ -53,11 +55,9 @@ void setup() {
   tsPanel.setInterruptMode (FT62XX_INTERRUPT_TRIGGER); // Continous triggering
   // tsPanel.setInterruptMode (FT62XX_INTERRUPT_POLLING); // One trigger at a time
 
-  // Either use internal pullup or external pullup. Line is active low.
-  pinMode (FT6206_PIN_INT, INPUT_PULLUP);
-
-  // Attach the interrupt function.
-  attachInterrupt (digitalPinToInterrupt (FT6206_PIN_INT), touchISR, FALLING);
+  // Start the built-in interrupt mode. The library attaches the interrupt to the INT pin
+  // and marks a frame as pending on every falling edge.
+  tsPanel.beginInterrupt (&frameQueue);
   delay (1000);
 
 }
@@ -65,49 +65,55 @@ void setup() {
 //============================================================================================//
 
 void loop() {
-  if (intReceived) {
-    readTouch();
-    intReceived = false;
-    attachInterrupt (digitalPinToInterrupt (FT6206_PIN_INT), touchISR, FALLING);
+  // Read any pending frame into the queue. This never blocks when no frame is pending.
+  // Call it more often than the scan period (10 ms), or frames get merged; frame.lostEdges
+  // then tells how many were missed.
+  tsPanel.service();
+
+  // Print all queued frames.
+  CSE_FT6206_Frame frame;
+
+  while (frameQueue.pop (frame)) {
+    readTouch (frame);
   }
 }
 
 //============================================================================================//
 /**
- * @brief Reads all touch points from the panel and print their info to the serial monitor.
+ * @brief Prints the touch points of a frame to the serial monitor.
  * 
+ * @param frame The frame to print.
  */
-void readTouch() {
-  // Read all touch data.
-  // tsPanel.readData();
-
+void readTouch (const CSE_FT6206_Frame &frame) {
   // Print the touch point data.
   for (uint8_t i = 0; i < 2; i++) {
-    if (tsPanel.isTouched (i)) {
-      Serial.print ("ID: ");
-      Serial.print (i);
-      Serial.print (", X: ");
-      Serial.print (tsPanel.getPoint (i).x);
-      Serial.print (", Y: ");
-      Serial.print (tsPanel.getPoint (i).y);
-      Serial.print (", Z: ");
-      Serial.print (tsPanel.getPoint (i).z);
-      Serial.print (", State: ");
-      Serial.print (tsPanel.getPoint (i).state);
-      if (tsPanel.getPoint (i).state == 0) Serial.println (" (Press Down)");
-      else if (tsPanel.getPoint (i).state == 1) Serial.println (" (Lift Up)");
-      else if (tsPanel.getPoint (i).state == 2) Serial.println (" (Contact)");
-      else if (tsPanel.getPoint (i).state == 3) Serial.println (" (No Event)");
+    const CSE_TouchPoint &point = frame.points [i];
+
+    if (point.state == FT62XX_TOUCH_NONE) {
+      continue;
     }
-  }
-}
 
-//============================================================================================//
+    Serial.print ("T: ");
+    Serial.print (frame.timestamp);
+    Serial.print (", ID: ");
+    Serial.print (i);
+    Serial.print (", X: ");
+    Serial.print (point.x);
+    Serial.print (", Y: ");
+    Serial.print (point.y);
+    Serial.print (", Z: ");
+    Serial.print (point.z);
+    Serial.print (", State: ");
+    Serial.print (point.state);
+    if (point.state == 0) Serial.println (" (Press Down)");
+    else if (point.state == 1) Serial.println (" (Lift Up)");
+    else if (point.state == 2) Serial.println (" (Contact)");
+  }
 
-void touchISR() {
-  // Detach the interrupt to prevent multiple interrupts
-  detachInterrupt (digitalPinToInterrupt (FT6206_PIN_INT));
-  intReceived = true;
+  if (frameQueue.getOverflows() > 0) {
+    Serial.print ("Dropped frames: ");
+    Serial.println (frameQueue.getOverflows());
+  }
 }
 
-//============================================================================================//
\ No newline at end of file
+//============================================================================================//
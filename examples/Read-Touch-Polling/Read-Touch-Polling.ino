@@ -63,11 +63,11 @@ void loop() {
  * 
  */
 void readTouch() {
+  tsPanel.update(); // Read all touch data once. The functions below serve from this frame.
+
   uint8_t touches = tsPanel.getTouches(); // Get the number of touches currently detected.
 
   if (touches > 0) { // If any touches are detected.
-    tsPanel.readData();
-    
     for (uint8_t i = 0; i < touches; i++) {
       Serial.print ("ID: ");
       Serial.print (i);
@@ -0,0 +1,99 @@
+//============================================================================================//
+/*
+  Filename: AsyncI2C_Sim.cpp
+  Description: Simulator of an I2C peripheral with background reads for host builds.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 01:46:30 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "AsyncI2C_Sim.h"
+#include <math.h>
+
+//============================================================================================//
+
+AsyncI2C_Sim:: AsyncI2C_Sim (TwoWire *i2c) : wire (i2c) {
+  this->i2c = i2c;
+  async = true;
+  stalled = false;
+  busy = false;
+  status = FT6206_I2C_OK;
+  endTime = 0;
+  starts = 0;
+  polls = 0;
+}
+
+//============================================================================================//
+
+void AsyncI2C_Sim:: begin (void) {
+  wire.begin();
+}
+
+void AsyncI2C_Sim:: setClock (uint32_t clock) {
+  wire.setClock (clock);
+}
+
+uint8_t AsyncI2C_Sim:: probe (uint8_t address) {
+  return wire.probe (address);
+}
+
+uint8_t AsyncI2C_Sim:: readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) {
+  return wire.readRegisters (address, reg, buffer, length);
+}
+
+uint8_t AsyncI2C_Sim:: writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length) {
+  return wire.writeRegisters (address, reg, buffer, length);
+}
+
+//============================================================================================//
+/**
+  @brief  Starts a background read. The transfer is made on the bus now with the clock
+  stopped, and its bus time is added to the time at which it ends. Setting up the read
+  costs ASYNC_I2C_SIM_START_NS of CPU time.
+
+  @returns True, or false if background reads are disabled.
+*/
+bool AsyncI2C_Sim:: startRead (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) {
+  if (!async) {
+    return false;
+  }
+
+  uint32_t bits = i2c->getStats().bits;
+  i2c->setTimed (false);
+  status = wire.readRegisters (address, reg, buffer, length);
+  i2c->setTimed (true);
+  bits = i2c->getStats().bits - bits;
+
+  hostAdvanceNanos (ASYNC_I2C_SIM_START_NS);
+  endTime = hostMicros64() + uint64_t (ceil (TwoWire:: busTimeMicros (bits, i2c->getClock())));
+  busy = true;
+  starts++;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Reports whether the started read has ended. Each poll costs
+  ASYNC_I2C_SIM_POLL_NS of CPU time, so that a busy wait reaches the end.
+
+  @returns FT6206_I2C_PENDING until the bus time has passed, then the result. Always
+  FT6206_I2C_PENDING while stalled.
+*/
+uint8_t AsyncI2C_Sim:: getReadStatus (void) {
+  polls++;
+  hostAdvanceNanos (ASYNC_I2C_SIM_POLL_NS);
+
+  if (busy && (stalled || (hostMicros64() < endTime))) {
+    return FT6206_I2C_PENDING;
+  }
+
+  busy = false;
+  return status;
+}
+
+//============================================================================================//
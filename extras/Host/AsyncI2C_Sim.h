@@ -0,0 +1,70 @@
+//============================================================================================//
+/*
+  Filename: AsyncI2C_Sim.h
+  Description: Simulator of an I2C peripheral that runs register reads in the background,
+  like an interrupt or DMA driven controller, for host builds. The bus time of a read
+  elapses on the virtual clock while the CPU is free.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 01:46:30 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef ASYNC_I2C_SIM_H
+#define ASYNC_I2C_SIM_H
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "CSE_FT6206.h"
+
+#define ASYNC_I2C_SIM_START_NS  2000  // CPU time to set up a background read
+#define ASYNC_I2C_SIM_POLL_NS   500   // CPU time of a status poll
+
+//============================================================================================//
+/*!
+  @brief  Transport with background reads over the simulated TwoWire. A started read is
+  done on the bus at once without advancing the clock, and reports its end only when the
+  clock has passed its bus time. Blocking transfers are the same as on
+  CSE_FT6206_WireTransport.
+*/
+class AsyncI2C_Sim : public CSE_FT6206_Transport {
+  public:
+    AsyncI2C_Sim (TwoWire *i2c = &Wire);
+
+    // CSE_FT6206_Transport interface.
+
+    void begin (void) override;
+    void setClock (uint32_t clock) override;
+    uint8_t probe (uint8_t address) override;
+    uint8_t readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) override;
+    uint8_t writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length) override;
+    bool startRead (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) override;
+    uint8_t getReadStatus (void) override;
+
+    // Simulation control.
+
+    void setAsync (bool enable) { async = enable; } // False to report no background reads
+    void setStalled (bool enable) { stalled = enable; } // True to never end the started reads
+    bool isBusy (void) const { return busy; }
+    uint32_t getStarts (void) const { return starts; }
+    uint32_t getPolls (void) const { return polls; }
+
+  private:
+    TwoWire *i2c;
+    CSE_FT6206_WireTransport wire;
+    bool async;
+    bool stalled; // Started reads stay pending, like a DMA transfer that lost its interrupt
+    bool busy;  // A started read has not reported its end yet
+    uint8_t status; // Result of the started read
+    uint64_t endTime; // hostMicros64() at which the started read ends
+    uint32_t starts;
+    uint32_t polls;
+};
+
+//============================================================================================//
+
+#endif // ASYNC_I2C_SIM_H
@@ -0,0 +1,2660 @@
+//============================================================================================//
+/*
+  Filename: Bench.cpp
+  Description: Host-side bus-cost benchmark for the CSE_FT6206 library. Runs every public
+  data API against the FT6206 simulator and reports the number of I2C transactions, bytes
+  on the wire and the modeled bus time at 100, 400 and 1000 kHz. Run with --check to fail
+  when any API exceeds its budget.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <functional>
+#include <chrono>
+#include <errno.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "CSE_FT6206.h"
+#include "FT6206_Sim.h"
+#include "TCA9548A_Sim.h"
+#include "AsyncI2C_Sim.h"
+
+#define BENCH_PIN_RST  4
+#define BENCH_PIN_INT  25
+#define BENCH_PIN_SDA  21
+#define BENCH_PIN_SCL  22
+#define BENCH_PIN_INT_A  26
+#define BENCH_PIN_INT_B  27
+#define BENCH_RENDER_US  1000  // Work done between starting and finishing a split-phase read
+
+//============================================================================================//
+/*!
+  @brief  Bus budget of one benchmark case. The check fails if a case uses more
+  transactions or bytes than this.
+*/
+struct BenchBudget {
+  const char *name;
+  uint32_t maxTransactions;
+  uint32_t maxBytes;
+};
+
+// These budgets are the current cost of each call. Lower them when the library improves
+// so that regressions are caught.
+static const BenchBudget budgets[] = {
+  { "readData() idle",                2,   6 },
+  { "readData() touch down",          4,   15 },
+  { "readData()",                     2,   12 },
+  { "readData() 2 fingers",           2,   18 },
+  { "update()",                       2,   12 },
+  { "fastReadData(0)",                2,   9 },
+  { "getPoint(0)",                    0,   0 },
+  { "isTouched(0)",                   0,   0 },
+  { "getTouches()",                   0,   0 },
+  { "getGestureName()",               0,   0 },
+  { "example: readTouch() 1 finger",  2,   18 },
+  { "example: readTouch() 2 fingers", 2,   18 },
+  { "readData() full read",           2,   18 },
+  { "refreshConfig()",                4,   30 },
+  { "getActiveScanRate()",            0,   0 },
+  { "getInterruptMode()",             0,   0 },
+  { "setActiveScanRate()",            3,   7 },
+  { "applyProfile() unchanged",       0,   0 },
+  { "applyProfile() 3 registers",     6,   16 },
+  { "readData() 1 NACK retried",      3,   14 },
+  { "readData() 3 NACKs dropped",     3,   6 },
+  { "readData() short read retried",  4,   23 },
+  { "scheduler: 4 panels, 1 round",   10,  52 },
+  { "lite readData() 1 point",        2,   12 },
+  { "lite readData() 2 points",       2,   18 },
+};
+
+static FT6206_Sim sim;
+static CSE_FT6206 tsPanel (240, 320, &Wire, BENCH_PIN_RST, BENCH_PIN_INT);
+static int failures = 0;
+static bool checkBudgets = false;
+
+//============================================================================================//
+/**
+  @brief  Loads a frame with the given number of fingers down into the simulator.
+*/
+static void loadTouches (FT6206_Sim &target, uint8_t touches) {
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+  frame.touches = touches;
+
+  for (uint8_t i = 0; i < touches; i++) {
+    frame.points [i].x = uint16_t (100 + (i * 40));
+    frame.points [i].y = uint16_t (150 + (i * 40));
+    frame.points [i].event = 2; // Contact
+    frame.points [i].id = i;
+    frame.points [i].weight = 24;
+    frame.points [i].area = 3;
+  }
+
+  target.setFrame (frame);
+}
+
+static void loadTouches (uint8_t touches) {
+  loadTouches (sim, touches);
+}
+
+//============================================================================================//
+/**
+  @brief  Reads every point through the accessors, like readTouch() in the
+  Read-Touch-Interrupt example did before the built-in interrupt mode.
+*/
+static void exampleReadTouch (void) {
+  volatile int16_t sink = 0;
+
+  tsPanel.update();
+
+  for (uint8_t i = 0; i < 2; i++) {
+    if (tsPanel.isTouched (i)) {
+      sink = tsPanel.getPoint (i).x;
+      sink = tsPanel.getPoint (i).y;
+      sink = tsPanel.getPoint (i).z;
+      sink = tsPanel.getPoint (i).state;
+      if (tsPanel.getPoint (i).state == 0) sink = 0;
+      else if (tsPanel.getPoint (i).state == 1) sink = 1;
+      else if (tsPanel.getPoint (i).state == 2) sink = 2;
+      else if (tsPanel.getPoint (i).state == 3) sink = 3;
+    }
+  }
+
+  (void) sink;
+}
+
+//============================================================================================//
+/**
+  @brief  Runs one case, prints its bus cost and checks it against its budget.
+*/
+static void measure (const char *name, std::function <void (void)> fn) {
+  Wire.resetStats();
+  fn();
+  HostWireStats stats = Wire.getStats();
+
+  const BenchBudget *budget = nullptr;
+
+  for (size_t i = 0; i < sizeof (budgets) / sizeof (budgets [0]); i++) {
+    if (strcmp (budgets [i].name, name) == 0) {
+      budget = &budgets [i];
+      break;
+    }
+  }
+
+  const char *verdict = "-";
+
+  if (budget != nullptr) {
+    bool over = (stats.transactions > budget->maxTransactions) || (stats.bytes > budget->maxBytes);
+    verdict = over ? "OVER" : "ok";
+
+    if (over && checkBudgets) {
+      failures++;
+    }
+  }
+
+  printf ("%-32s %6u %6u %6u %10.1f %10.1f %10.1f  %s\n", name,
+    stats.transactions, stats.bytes, stats.bits,
+    TwoWire:: busTimeMicros (stats.bits, 100000),
+    TwoWire:: busTimeMicros (stats.bits, 400000),
+    TwoWire:: busTimeMicros (stats.bits, 1000000),
+    verdict);
+}
+
+//============================================================================================//
+/**
+  @brief  Drives a scripted drag (touch-down, moves, lift-up) through the built-in interrupt
+  mode. The controller reports a frame every 10 ms and the consumer pops all queued frames
+  only every popEvery reports. Checks that the touch-down and lift-up always reach the
+  consumer, even when frames are dropped.
+*/
+static void measureInterruptQueue (const char *name, uint8_t popEvery) {
+  static FT6206_SimFrame script [24];
+  const size_t length = sizeof (script) / sizeof (script [0]);
+
+  for (size_t i = 0; i < length; i++) {
+    memset (&script [i], 0, sizeof (script [i]));
+    FT6206_SimPoint &point = script [i].points [0];
+    point.x = uint16_t (20 + (i * 8));
+    point.y = 100;
+    point.weight = 20;
+    point.event = (i == 0) ? 0 : ((i == (length - 1)) ? 1 : 2);
+    script [i].touches = (i == (length - 1)) ? 0 : 1;
+  }
+
+  CSE_FT6206_Frame buffer [8];
+  CSE_FT6206_FrameQueue queue (buffer, 8);
+  CSE_FT6206_Frame frame;
+  uint32_t popped = 0, downs = 0, ups = 0;
+
+  sim.loadScript (script, length);
+  tsPanel.beginInterrupt (&queue);
+  Wire.resetStats();
+
+  for (size_t i = 0; i < length; i++) {
+    sim.step();
+    tsPanel.service();
+
+    if (((i + 1) % popEvery == 0) || (i == (length - 1))) {
+      while (queue.pop (frame)) {
+        popped++;
+        downs += (frame.points [0].state == FT62XX_TOUCH_DOWN) ? 1 : 0;
+        ups += (frame.points [0].state == FT62XX_TOUCH_UP) ? 1 : 0;
+      }
+    }
+
+    delay (10);
+  }
+
+  tsPanel.endInterrupt();
+  HostWireStats stats = Wire.getStats();
+  bool lost = (downs != 1) || (ups != 1);
+
+  if (lost && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %6u %6u frames %u/%u popped, %u dropped, down %u up %u  %s\n", name,
+    stats.transactions, stats.bytes, (unsigned) popped, (unsigned) length,
+    (unsigned) queue.getOverflows(), (unsigned) downs, (unsigned) ups, lost ? "LOST" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Lets a tap (touch-down and lift-up) and a later touch-down arrive between two
+  service() calls, and checks that the merged edges are reported with the frame and, with
+  the metrics, counted. Then checks that a frame serviced in time reports none.
+*/
+static void checkMergedEdges (void) {
+  static FT6206_SimFrame script [4];
+  const uint8_t events [4] = { FT62XX_TOUCH_DOWN, FT62XX_TOUCH_UP, FT62XX_TOUCH_DOWN, FT62XX_TOUCH_CONTACT };
+
+  for (uint8_t i = 0; i < 4; i++) {
+    memset (&script [i], 0, sizeof (script [i]));
+    script [i].points [0] = { uint16_t (40 + (i * 10)), 100, events [i], 0, 20, 1 };
+    script [i].touches = (events [i] == FT62XX_TOUCH_UP) ? 0 : 1;
+  }
+
+  CSE_FT6206_Frame buffer [4];
+  CSE_FT6206_FrameQueue queue (buffer, 4);
+  CSE_FT6206_Frame first, second;
+
+  #ifdef CSE_FT6206_METRICS
+    tsPanel.resetMetrics();
+  #endif
+
+  sim.loadScript (script, 4);
+  tsPanel.beginInterrupt (&queue);
+
+  // Three edges, one service().
+  for (uint8_t i = 0; i < 3; i++) {
+    sim.step();
+    delay (10);
+  }
+
+  uint8_t queued = tsPanel.service();
+  sim.step();
+  queued += tsPanel.service();
+  tsPanel.endInterrupt();
+
+  bool wrong = (queued != 2) || !queue.pop (first) || !queue.pop (second) || (first.lostEdges != 2) || (second.lostEdges != 0);
+  char counted [24] = "no metrics";
+
+  #ifdef CSE_FT6206_METRICS
+    CSE_FT6206_Metrics metrics;
+    tsPanel.getMetrics (metrics);
+    snprintf (counted, sizeof (counted), "%u counted", (unsigned) metrics.lostEdges);
+    wrong = wrong || (metrics.lostEdges != 2);
+  #endif
+
+  sim.clearTouches();
+  tsPanel.readData();
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s 3 edges in one service(), frame reports %u lost, %s  %s\n", "queue: merged edges",
+    (unsigned) first.lostEdges, counted, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Initializes a second panel with beginAsync() and poll(), and reports how long the
+  initialization took and the longest time any poll() call blocked.
+*/
+static void measureAsyncBegin (void) {
+  CSE_FT6206 panel (240, 320, &Wire, BENCH_PIN_RST, BENCH_PIN_INT);
+  uint64_t start = hostMicros64();
+  uint64_t longest = 0;
+  uint32_t polls = 0;
+  uint8_t state = FT6206_INIT_IDLE;
+
+  Wire.resetStats();
+  panel.beginAsync();
+
+  while ((state != FT6206_INIT_READY) && (state != FT6206_INIT_FAILED)) {
+    uint64_t before = hostMicros64();
+    state = panel.poll();
+    uint64_t blocked = hostMicros64() - before;
+    longest = (blocked > longest) ? blocked : longest;
+    polls++;
+    hostAdvanceMicros (1000);  // Other work done by the application between polls
+  }
+
+  HostWireStats stats = Wire.getStats();
+  bool slow = (longest > 2000) || (state != FT6206_INIT_READY);
+
+  if (slow && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %6u %6u init %.1f ms, %u polls, longest poll %u us  %s\n", "beginAsync() + poll()",
+    stats.transactions, stats.bytes, double (hostMicros64() - start) / 1000.0, (unsigned) polls,
+    (unsigned) longest, slow ? "SLOW" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Checks the identification: blank IDs are retried until they read valid, an
+  FT6236U and a panel ID of another maker are accepted, the latter with a flag, and an
+  unknown chip or IDs that stay blank fail the initialization.
+*/
+static void checkIdentify (void) {
+  CSE_FT6206 panel (240, 320, &Wire);
+  uint8_t state = FT6206_INIT_IDLE;
+  uint64_t identifyStart = 0;
+  uint16_t identifyMs = 0;
+
+  // The controller ACKs after its boot delay but reads blank IDs for another 50 ms.
+  sim.regs [FT62XX_REG_CIPHER] = 0xFF;
+  panel.beginAsync();
+
+  while ((state != FT6206_INIT_READY) && (state != FT6206_INIT_FAILED)) {
+    if (state == FT6206_INIT_IDENTIFY) {
+      identifyStart = (identifyStart == 0) ? hostMicros64() : identifyStart;
+      identifyMs++;
+
+      if ((hostMicros64() - identifyStart) >= 50000) {
+        sim.regs [FT62XX_REG_CIPHER] = FT62XX_VALUE_CHIP_ID;
+      }
+    }
+
+    state = panel.poll();
+    hostAdvanceMicros (1000);
+  }
+
+  bool wrong = (state != FT6206_INIT_READY) || (panel.getIDMismatch() != FT6206_ID_OK) || (identifyMs < 50);
+
+  // A variant with a panel of another maker.
+  CSE_FT6206 variant (240, 320, &Wire);
+  sim.regs [FT62XX_REG_CIPHER] = FT62XX_VALUE_CHIP_ID_FT6236U;
+  sim.regs [FT62XX_REG_FOCALTECH_ID] = 0x22;
+  wrong = wrong || !variant.begin() || (variant.getIDMismatch() != FT6206_ID_PANEL_MISMATCH) || (variant.getChipID() != 0x64);
+
+  // An unknown chip, and IDs that never become valid.
+  CSE_FT6206 unknown (240, 320, &Wire);
+  sim.regs [FT62XX_REG_CIPHER] = 0x12;
+  sim.regs [FT62XX_REG_FOCALTECH_ID] = FT62XX_VALUE_PANEL_ID;
+  wrong = wrong || unknown.begin() || (unknown.getIDMismatch() != FT6206_ID_CHIP_MISMATCH);
+
+  CSE_FT6206 blank (240, 320, &Wire);
+  sim.regs [FT62XX_REG_CIPHER] = 0x00;
+  uint64_t start = hostMicros64();
+  wrong = wrong || blank.begin() || (blank.getInitState() != FT6206_INIT_FAILED) ||
+    (blank.getIDMismatch() != FT6206_ID_CHIP_MISMATCH) || ((hostMicros64() - start) < (FT6206_BOOT_DELAY_MS + FT6206_IDENTIFY_TIMEOUT_MS) * 1000ULL);
+
+  sim.regs [FT62XX_REG_CIPHER] = FT62XX_VALUE_CHIP_ID;
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s blank IDs for %u ms retried, FT6236U and other panel ok, unknown and blank fail  %s\n",
+    "identify: chip and panel IDs", (unsigned) identifyMs, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Stand-in for the i2c-dev ioctl() that runs the I2C_RDWR messages on the simulated
+  bus. Consecutive messages are joined with a repeated START, like the adapter drivers do,
+  and failures are reported with the errno values of the kernel.
+*/
+static int simulatedIoctl (int fd, unsigned long request, void *argument) {
+  (void) fd;
+
+  if (request != I2C_RDWR) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  const struct i2c_rdwr_ioctl_data *data = (const struct i2c_rdwr_ioctl_data *) argument;
+
+  for (uint32_t n = 0; n < data->nmsgs; n++) {
+    const struct i2c_msg &message = data->msgs [n];
+    bool last = (n + 1) == data->nmsgs;
+
+    if (message.flags & I2C_M_RD) {
+      uint8_t received = Wire.requestFrom (uint8_t (message.addr), uint8_t (message.len), uint8_t (last));
+
+      for (uint8_t i = 0; i < received; i++) {
+        message.buf [i] = uint8_t (Wire.read());
+      }
+
+      if (received == 0) {
+        errno = ENXIO;
+        return -1;
+      }
+    }
+    else {
+      Wire.beginTransmission (uint8_t (message.addr));
+      Wire.write (message.buf, message.len);
+      uint8_t status = Wire.endTransmission (last);
+
+      if (status != 0) {
+        errno = (status == 2) ? ENXIO : ((status == 3) ? EREMOTEIO : EIO);
+        return -1;
+      }
+    }
+  }
+
+  return int (data->nmsgs);
+}
+
+/**
+  @brief  Runs the same panel on the Linux i2c-dev transport, with the simulated ioctl on
+  /dev/null, and checks that it decodes the same points as on TwoWire with one system call
+  and one STOP per frame read. A straight port that selects the device with I2C_SLAVE and
+  calls write() and read() is measured on the bus for comparison. Also checks that a NACK
+  is retried, that an absent device reports an address NACK and that a multiplexer selects
+  its channels through the transport.
+*/
+static void measureTransport (void) {
+  CSE_FT6206_LinuxI2C adapter ("/dev/null", simulatedIoctl);
+  CSE_FT6206 linuxPanel (240, 320, &adapter);
+  bool wrong = !linuxPanel.begin() || !adapter.isOpen();
+
+  loadTouches (2);
+  tsPanel.readData();
+  linuxPanel.readData();
+
+  for (uint8_t n = 0; n < 2; n++) {
+    wrong = wrong || (linuxPanel.getPoint (n) != tsPanel.getPoint (n)) || (linuxPanel.getPoint (n).state != tsPanel.getPoint (n).state);
+  }
+
+  // One frame: the combined read against two separate transfers.
+  loadTouches (1);
+  linuxPanel.readData();
+  tsPanel.readData();
+  uint32_t calls = adapter.getCallCount();
+  Wire.resetStats();
+  linuxPanel.readData();
+  HostWireStats combined = Wire.getStats();
+  calls = adapter.getCallCount() - calls;
+
+  uint8_t frame [FT62XX_FRAME_LENGTH];
+  uint8_t reg = FT62XX_REG_DEV_MODE;
+  Wire.resetStats();
+  Wire.beginTransmission (uint8_t (FT62XX_I2C_ADDR));  // write()
+  Wire.write (&reg, 1);
+  Wire.endTransmission();
+  Wire.requestFrom (uint8_t (FT62XX_I2C_ADDR), uint8_t (FT62XX_REG_P1_XH + 6));  // read()
+  wrong = wrong || (Wire.available() != (FT62XX_REG_P1_XH + 6));
+
+  for (uint8_t i = 0; Wire.available(); i++) {
+    frame [i] = uint8_t (Wire.read());
+  }
+
+  HostWireStats naive = Wire.getStats();
+
+  // A NACK is retried, and an absent device is an address NACK.
+  CSE_FT6206_I2CStats before = linuxPanel.getI2CStats();
+  sim.failNextWrites (1);
+  wrong = wrong || !linuxPanel.readData() || (linuxPanel.getI2CStats().retries != (before.retries + 1)) ||
+    (adapter.getLastErrno() != 0) || (adapter.probe (0x10) != FT6206_I2C_ADDRESS_NACK) || (adapter.getLastErrno() != ENXIO);
+  wrong = wrong || (calls != 1) || (combined.stops != 1) || (combined.transactions != 2) || (naive.stops != 2) ||
+    (frame [FT62XX_REG_TD_STATUS] != 1);
+
+  // The multiplexer selects through the same transport, one single byte write per switch.
+  TCA9548A_Sim muxSim;
+  CSE_FT6206_Mux mux (&adapter);
+  Wire.attachDevice (&muxSim);
+  uint32_t muxCalls = adapter.getCallCount();
+  wrong = wrong || !mux.select (3) || !mux.select (3) || (muxSim.getControl() != 0x08) || (muxSim.getWrites() != 1) ||
+    ((adapter.getCallCount() - muxCalls) != 1) || !mux.disable() || (muxSim.getControl() != 0x00);
+  Wire.detachDevices();
+  Wire.attachDevice (&sim);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s i2c-dev %u call, %u STOP, %u bits; write() + read() 2 calls, %u STOPs, %u bits  %s\n",
+    "transport: 1 finger frame", (unsigned) calls, (unsigned) combined.stops, (unsigned) combined.bits,
+    (unsigned) naive.stops, (unsigned) naive.bits, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Counts the ends of split-phase reads.
+*/
+static uint32_t splitReads;
+static uint32_t splitFailures;
+
+static void onSplitRead (bool success) {
+  splitReads++;
+  splitFailures += success ? 0 : 1;
+}
+
+/**
+  @brief  Reads a moving two-finger frame at 400 kHz with readData() and with the
+  split-phase read on the background transport, with rendering work between startRead()
+  and isReadComplete(). Compares the CPU time each takes per frame and checks that both
+  decode the same points. Also checks the tail read, a retried NACK, a second start while
+  a read is in flight, the timeout of a transfer that never ends, and the blocking
+  fallback.
+*/
+static void measureSplitRead (void) {
+  const uint8_t frames = 50;
+  uint32_t clock = Wire.getClock();
+  AsyncI2C_Sim engine (&Wire);
+  CSE_FT6206 splitPanel (240, 320, &engine);
+  bool wrong = !splitPanel.begin();
+
+  Wire.setClock (400000);
+  splitPanel.setReadCallback (onSplitRead);
+  splitReads = 0;
+  splitFailures = 0;
+  loadTouches (2);
+  tsPanel.readData();
+  splitPanel.readData();
+
+  uint64_t blockingTime = 0;
+  uint64_t splitTime = 0;
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+  frame.touches = 2;
+
+  for (uint8_t i = 0; i < frames; i++) {
+    for (uint8_t n = 0; n < 2; n++) {
+      frame.points [n] = { uint16_t (40 + (i * 3) + (n * 60)), uint16_t (200 - (i * 2)), 2, n, 24, 3 };
+    }
+
+    sim.setFrame (frame);
+
+    uint64_t start = hostMicros64();
+    tsPanel.readData();
+    blockingTime += hostMicros64() - start;
+
+    start = hostMicros64();
+    bool started = splitPanel.startRead();
+    bool early = splitPanel.isReadComplete();
+    splitTime += hostMicros64() - start;
+
+    hostAdvanceMicros (BENCH_RENDER_US);
+
+    start = hostMicros64();
+    bool done = splitPanel.isReadComplete();
+    splitTime += hostMicros64() - start;
+
+    wrong = wrong || !started || early || !done;
+
+    for (uint8_t n = 0; n < 2; n++) {
+      wrong = wrong || (splitPanel.getPoint (n) != tsPanel.getPoint (n));
+    }
+  }
+
+  // The touch count rises above the prediction, so the point registers are read by a tail
+  // read after the head read ends.
+  loadTouches (0);
+  splitPanel.readData();
+  loadTouches (2);
+  tsPanel.readData();
+  wrong = wrong || !splitPanel.startRead() || splitPanel.startRead();
+  hostAdvanceMicros (BENCH_RENDER_US);
+  wrong = wrong || splitPanel.isReadComplete() || (splitPanel.getReadPhase() != FT6206_READ_TAIL);
+  hostAdvanceMicros (BENCH_RENDER_US);
+  wrong = wrong || !splitPanel.isReadComplete() || (splitPanel.getTouches() != 2) ||
+    (splitPanel.getPoint (1) != tsPanel.getPoint (1));
+
+  // A NACK is retried in the background.
+  CSE_FT6206_I2CStats before = splitPanel.getI2CStats();
+  sim.failNextWrites (1);
+  splitPanel.startRead();
+  hostAdvanceMicros (BENCH_RENDER_US);
+  wrong = wrong || splitPanel.isReadComplete();
+  hostAdvanceMicros (BENCH_RENDER_US);
+  wrong = wrong || !splitPanel.isReadComplete() || (splitPanel.getI2CStats().retries != (before.retries + 1));
+
+  // A transfer that never ends times out on every attempt and drops the frame, and a
+  // blocking access after it does not hang.
+  engine.setStalled (true);
+  before = splitPanel.getI2CStats();
+  uint64_t stallStart = hostMicros64();
+  uint32_t stallFailures = splitFailures;
+  splitPanel.startRead();
+  uint8_t mode = splitPanel.readRegister8 (FT62XX_REG_G_MODE);
+  uint64_t stallTime = hostMicros64() - stallStart;
+  engine.setStalled (false);
+  wrong = wrong || (splitPanel.getReadPhase() != FT6206_READ_IDLE) || (splitFailures != (stallFailures + 1)) ||
+    (stallTime < ((FT6206_DEFAULT_I2C_RETRIES + 1) * FT6206_READ_TIMEOUT_US)) ||
+    (splitPanel.getI2CStats().failures != (before.failures + 1)) || (mode != sim.regs [FT62XX_REG_G_MODE]);
+
+  // Without background reads, the read is made blocking and ends at the first check.
+  engine.setAsync (false);
+  uint32_t starts = engine.getStarts();
+  wrong = wrong || !splitPanel.startRead() || !splitPanel.isReadComplete() || (engine.getStarts() != starts);
+
+  wrong = wrong || (splitReads != (frames + 4)) || (splitFailures != 1) || ((splitTime * 10) > blockingTime);
+  Wire.setClock (clock);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s readData() %.1f us, startRead() + isReadComplete() %.1f us of CPU per frame  %s\n",
+    "split-phase read: 2 fingers", double (blockingTime) / frames, double (splitTime) / frames,
+    wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Feeds a two-finger sequence through the tracker: finger A lands and rests, finger
+  B lands, both move, the controller swaps their hardware IDs, then both lift. Checks that
+  events are only emitted on change and that the track IDs survive the swap.
+*/
+static void measureTracker (void) {
+  static FT6206_SimFrame script [64];
+  size_t length = 0;
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+
+  // Finger A lands and rests for 30 frames.
+  frame.touches = 1;
+  frame.points [0] = { 50, 50, 0, 0, 20, 1 };
+  script [length++] = frame;
+  frame.points [0].event = 2;
+
+  for (int i = 0; i < 30; i++) {
+    script [length++] = frame;
+  }
+
+  // Finger B lands, then both move 10 pixels per frame.
+  frame.touches = 2;
+  frame.points [1] = { 250, 200, 0, 1, 20, 1 };
+  script [length++] = frame;
+  frame.points [1].event = 2;
+
+  for (int i = 0; i < 10; i++) {
+    frame.points [0].x += 10;
+    frame.points [1].y -= 10;
+    script [length++] = frame;
+  }
+
+  // The controller swaps the hardware IDs and the register slots as both keep moving.
+  frame.points [0].x += 10;
+  frame.points [1].y -= 10;
+  FT6206_SimPoint a = frame.points [0];
+  frame.points [0] = frame.points [1];
+  frame.points [1] = a;
+  frame.points [0].id = 0;
+  frame.points [1].id = 1;
+  script [length++] = frame;
+
+  // Both fingers lift.
+  frame.touches = 0;
+  frame.points [0].event = 1;
+  frame.points [1].event = 1;
+  script [length++] = frame;
+
+  CSE_FT6206_Tracker tracker;
+  CSE_FT6206_TouchEvent event;
+  uint32_t counts [4] = { 0, 0, 0, 0 };
+  bool swapped = false;
+
+  sim.loadScript (script, length);
+  tsPanel.attachTracker (&tracker);
+
+  while (sim.step()) {
+    tsPanel.update();
+
+    while (tracker.popEvent (event)) {
+      counts [event.type]++;
+
+      // Finger A (track 0) only moves along x and finger B (track 1) only along y.
+      if (event.type == FT6206_EVENT_MOVE) {
+        swapped = swapped || ((event.id == 0) && (event.y != 50)) || ((event.id == 1) && (event.x != 250));
+      }
+    }
+  }
+
+  tsPanel.attachTracker (NULL);
+
+  bool wrong = (counts [FT6206_EVENT_DOWN] != 2) || (counts [FT6206_EVENT_UP] != 2) ||
+    (counts [FT6206_EVENT_CANCEL] != 0) || (counts [FT6206_EVENT_MOVE] != 22) || swapped;
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u frames -> %u events (down %u move %u up %u cancel %u)  %s\n", "tracker: rest, move, swap",
+    (unsigned) length, (unsigned) (counts [0] + counts [1] + counts [2] + counts [3]),
+    (unsigned) counts [0], (unsigned) counts [1], (unsigned) counts [2], (unsigned) counts [3],
+    wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+
+static FT6206_SimFrame gestureScript [320];
+static size_t gestureLength = 0;
+
+/**
+  @brief  Appends frames with one or two fingers in contact, or idle frames when both
+  points are NULL. The first frame of a touch is a touch-down, and an idle frame right
+  after a touch is a lift-up.
+*/
+static void addGestureFrames (size_t count, const FT6206_SimPoint *p1, const FT6206_SimPoint *p2) {
+  for (size_t i = 0; (i < count) && (gestureLength < (sizeof (gestureScript) / sizeof (gestureScript [0]))); i++) {
+    const FT6206_SimFrame *previous = (gestureLength > 0) ? &gestureScript [gestureLength - 1] : NULL;
+    FT6206_SimFrame &frame = gestureScript [gestureLength++];
+    memset (&frame, 0, sizeof (frame));
+    frame.points [0].event = 3;
+    frame.points [1].event = 3;
+    const FT6206_SimPoint *points [2] = { p1, p2 };
+
+    for (uint8_t n = 0; n < 2; n++) {
+      bool wasDown = (previous != NULL) && (n < previous->touches);
+
+      if (points [n] != NULL) {
+        frame.points [n] = *points [n];
+        frame.points [n].id = n;
+        frame.points [n].event = wasDown ? 2 : 0;
+        frame.touches++;
+      }
+      else if (wasDown && (previous->points [n].event != 1)) {
+        frame.points [n] = previous->points [n];
+        frame.points [n].event = 1;
+      }
+    }
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Feeds a finger with +/-3 pixels of noise that rests for 100 frames and then moves
+  at 5 pixels per frame, through each filter mode at 100 frames per second. Reports the
+  RMS error against the true position at rest and while moving, and the host CPU time per
+  two-finger frame. Checks that the touch-down passes through unchanged, that the filters
+  reduce the jitter at rest, that the 1-Euro filter keeps up with the move, that a frame
+  costs well under a microsecond on the host, and, with the metrics, that the 1-Euro filter
+  makes at most one runtime division per frame, for the cores without a hardware divider.
+*/
+static void measureFilter (const char *name, uint8_t mode) {
+  CSE_FT6206_Filter filter (mode);
+  CSE_TouchPoint points [2];
+  uint32_t seed = 12345;
+  uint64_t restSq = 0, moveSq = 0, rawSq = 0;
+  bool lagged = false;
+
+  for (int i = 0; i < 200; i++) {
+    int16_t truth = int16_t ((i < 100) ? 120 : (120 + ((i - 100) * 5)));
+    seed = (seed * 1103515245UL) + 12345UL;
+    int16_t noise = int16_t (((seed >> 16) % 7) - 3);
+
+    points [0] = CSE_TouchPoint (int16_t (truth + noise), 160, 20, 0);
+    points [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    points [1] = CSE_TouchPoint();
+    points [1].state = FT62XX_TOUCH_NONE;
+    filter.apply (points, 1, uint32_t (i) * 10000);
+
+    int32_t error = points [0].x - truth;
+    lagged = lagged || ((i == 0) && (noise != error));
+
+    if (i < 100) {
+      restSq += uint64_t (error * error);
+      rawSq += uint64_t (noise * noise);
+    }
+    else if (i >= 110) {
+      moveSq += uint64_t (error * error);
+    }
+  }
+
+  // CPU time of a two-finger frame.
+  const uint32_t iterations = 200000;
+  CSE_TouchPoint pair [2];
+  filter.reset();
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    pair [0] = CSE_TouchPoint (int16_t (100 + (i & 7)), int16_t (150 - (i & 3)), 20, 0);
+    pair [1] = CSE_TouchPoint (int16_t (180 - (i & 5)), int16_t (200 + (i & 7)), 20, 1);
+    pair [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    pair [1].state = pair [0].state;
+    filter.apply (pair, 2, i * 10000);
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  volatile int16_t sink = pair [0].x;
+  (void) sink;
+  double ns = std::chrono::duration <double, std::nano> (stop - start).count() / iterations;
+  double divisions = 0;
+
+  #ifdef CSE_FT6206_METRICS
+    divisions = double (filter.getDivisionCount()) / iterations;
+  #endif
+
+  double rawRms = sqrt (rawSq / 100.0);
+  double restRms = sqrt (restSq / 100.0);
+  double moveRms = sqrt (moveSq / 90.0);
+  bool wrong = lagged || (ns > 500.0) || (divisions > 1.0) || ((mode != FT6206_FILTER_NONE) && (restRms >= rawRms)) ||
+    ((mode == FT6206_FILTER_ONE_EURO) && (moveRms > 4.0));
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s rest rms %.2f px (raw %.2f), moving rms %.2f px, %.0f ns/frame, %.2f div/frame  %s\n", name,
+    restRms, rawRms, moveRms, ns, divisions, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Drags a finger back and forth along a sine at 100 frames per second through the
+  predictor, and reports the RMS distance to where the finger is one lookahead later, for
+  the measured and the predicted points, and the largest overshoot past the turning points.
+  Checks that the prediction reduces the error, that the touch-down, the lift-off and the
+  display edge are respected, and that an attached predictor follows the panel.
+*/
+static void measurePredictor (void) {
+  CSE_FT6206_Predictor predictor;
+  const double lookahead = predictor.getLookahead();
+  CSE_TouchPoint points [2];
+  double measuredSq = 0, predictedSq = 0, overshoot = 0;
+  bool wrong = false;
+  const int frames = 240;
+
+  // 80 pixels each way around x = 120, one period in 1.2 s.
+  auto truth = [] (double ms) { return 120.0 + (80.0 * sin ((2.0 * M_PI * ms) / 1200.0)); };
+
+  for (int i = 0; i < frames; i++) {
+    double ms = i * 10.0;
+    points [0] = CSE_TouchPoint (int16_t (lround (truth (ms))), 160, 20, 0);
+    points [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    points [1] = CSE_TouchPoint();
+    points [1].state = FT62XX_TOUCH_NONE;
+    predictor.update (points, 2, 240, 320, uint32_t (i) * 10000);
+
+    CSE_TouchPoint predicted = predictor.getPoint (0);
+    wrong = wrong || ((i == 0) && (predicted.x != points [0].x)) || (predicted.y != 160) ||
+      (predictor.getPoint (1).state != FT62XX_TOUCH_NONE);
+
+    double future = truth (ms + lookahead);
+    measuredSq += (points [0].x - future) * (points [0].x - future);
+    predictedSq += (predicted.x - future) * (predicted.x - future);
+    overshoot = fmax (overshoot, fmax (predicted.x - 200.0, 40.0 - predicted.x));
+  }
+
+  // The lift-off reports the measured point.
+  points [0].state = FT62XX_TOUCH_UP;
+  predictor.update (points, 2, 240, 320, frames * 10000);
+  wrong = wrong || (predictor.getPoint (0).x != points [0].x);
+
+  // A fast drag to the right edge stops at the edge.
+  for (int i = 0; i < 5; i++) {
+    points [0] = CSE_TouchPoint (int16_t (140 + (i * 20)), 160, 20, 0);
+    points [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    predictor.update (points, 2, 240, 320, 5000000 + (uint32_t (i) * 10000));
+    wrong = wrong || (predictor.getPoint (0).x > 239) || ((i >= 1) && (predictor.getPoint (0).x <= points [0].x));
+  }
+
+  // CPU time of a two-finger frame.
+  const uint32_t iterations = 200000;
+  CSE_TouchPoint pair [2];
+  predictor.reset();
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    pair [0] = CSE_TouchPoint (int16_t (20 + (i & 127)), int16_t (150 - (i & 3)), 20, 0);
+    pair [1] = CSE_TouchPoint (int16_t (180 - (i & 63)), int16_t (200 + (i & 7)), 20, 1);
+    pair [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    pair [1].state = pair [0].state;
+    predictor.update (pair, 2, 240, 320, i * 10000);
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  volatile int16_t sink = predictor.getPoint (0).x;
+  (void) sink;
+  double ns = std::chrono::duration <double, std::nano> (stop - start).count() / iterations;
+
+  // Attached, the first frame of a touch is reported as measured.
+  predictor.reset();
+  tsPanel.attachPredictor (&predictor);
+  loadTouches (1);
+  tsPanel.readData();
+  wrong = wrong || (predictor.getPoint (0).x != tsPanel.getPoint (0).x) || (predictor.getPoint (0).y != tsPanel.getPoint (0).y);
+  loadTouches (0);
+  tsPanel.readData();
+  tsPanel.attachPredictor (NULL);
+
+  double measuredRms = sqrt (measuredSq / frames);
+  double predictedRms = sqrt (predictedSq / frames);
+  wrong = wrong || (predictedRms > (measuredRms / 2)) || (overshoot > 4.0) || (ns > 500.0);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %.0f ms ahead, rms %.2f px (measured %.2f), overshoot %.1f px, %.0f ns/frame  %s\n",
+    "predictor: sine drag", lookahead, predictedRms, measuredRms, overshoot, ns, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Scrolls a finger at a constant 250 px/s with the controller reporting every
+  14.5 ms, and draws it on a 60 Hz display: once with the newest frame at each refresh, and
+  once resampled one scan period before the refresh. Reports the RMS deviation of the
+  per-refresh movement from its mean, which is the judder. Checks that resampling removes
+  most of it, that the touch-down, the lift-off and a tap shorter than a refresh are each
+  reported once at their measured positions, that the lookback bound and the newest frame
+  limit the output time, and that an attached resampler follows the panel.
+*/
+static void measureResampler (void) {
+  const uint32_t scanPeriod = 14500;
+  const uint32_t refreshPeriod = 16667;
+  CSE_FT6206_Resampler resampler;
+  CSE_TouchPoint points [2];
+  points [1] = CSE_TouchPoint();
+  points [1].state = FT62XX_TOUCH_NONE;
+  bool wrong = false;
+
+  auto position = [] (uint32_t us) { return int16_t (lround (290.0 - (us * 0.00025))); };
+
+  double rawSum = 0, rawSq = 0, resampledSum = 0, resampledSq = 0;
+  int16_t lastRaw = 0, lastResampled = 0;
+  uint32_t frameTime = 0;
+  int steps = 0;
+
+  for (int k = 0; k < 60; k++) {
+    uint32_t refresh = 20000 + (uint32_t (k) * refreshPeriod);
+
+    while (frameTime <= refresh) {
+      points [0] = CSE_TouchPoint (120, position (frameTime), 20, 0);
+      points [0].state = (frameTime == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+      resampler.update (points, 2, frameTime);
+      frameTime += scanPeriod;
+    }
+
+    resampler.sample (refresh - scanPeriod);
+    CSE_TouchPoint point = resampler.getPoint (0);
+
+    if (k == 0) {
+      wrong = wrong || (point.state != FT62XX_TOUCH_DOWN) || (point.y != position (0));
+    }
+    else {
+      wrong = wrong || (point.state != FT62XX_TOUCH_CONTACT) || (resampler.getPoint (1).state != FT62XX_TOUCH_NONE);
+    }
+
+    if (k >= 2) {
+      double rawStep = points [0].y - lastRaw;
+      double resampledStep = point.y - lastResampled;
+      rawSum += rawStep;
+      rawSq += rawStep * rawStep;
+      resampledSum += resampledStep;
+      resampledSq += resampledStep * resampledStep;
+      steps++;
+    }
+
+    lastRaw = points [0].y;
+    lastResampled = point.y;
+  }
+
+  double rawJudder = sqrt ((rawSq / steps) - ((rawSum / steps) * (rawSum / steps)));
+  double resampledJudder = sqrt ((resampledSq / steps) - ((resampledSum / steps) * (resampledSum / steps)));
+
+  // The lift-off is reported once, at its measured position.
+  points [0].y = 40;
+  points [0].state = FT62XX_TOUCH_UP;
+  resampler.update (points, 2, frameTime);
+  resampler.sample (frameTime);
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_UP) || (resampler.getPoint (0).y != 40);
+  resampler.sample (frameTime + refreshPeriod);
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_NONE);
+
+  // A tap between two refreshes is a touch-down, then a lift-off.
+  points [0] = CSE_TouchPoint (50, 60, 20, 0);
+  points [0].state = FT62XX_TOUCH_DOWN;
+  resampler.update (points, 2, 2000000);
+  points [0].state = FT62XX_TOUCH_UP;
+  resampler.update (points, 2, 2010000);
+  points [0].state = FT62XX_TOUCH_NONE;
+  resampler.update (points, 2, 2020000);
+  resampler.sample (2020000);
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_DOWN) || (resampler.getPoint (0).x != 50);
+  resampler.sample (2036667);
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_UP) || (resampler.getPoint (0).y != 60);
+  resampler.sample (2053334);
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_NONE);
+
+  // The output time is moved up to the lookback, and is not extrapolated past the newest frame.
+  for (int i = 0; i < 4; i++) {
+    points [0] = CSE_TouchPoint (int16_t (i * 100), 100, 20, 0);
+    points [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    resampler.update (points, 2, 3000000 + (uint32_t (i) * 10000));
+  }
+
+  resampler.sample (3000000);
+  resampler.sample (3030000 - 100000);
+  wrong = wrong || (resampler.getPoint (0).x != (300 - ((FT6206_DEFAULT_RESAMPLE_LOOKBACK * 100) / 10000)));
+  resampler.sample (3025000);
+  wrong = wrong || (resampler.getPoint (0).x != 250);
+  resampler.sample (3040000);
+  wrong = wrong || (resampler.getPoint (0).x != 300);
+
+  // CPU time of a two-finger frame and a refresh.
+  const uint32_t iterations = 200000;
+  CSE_TouchPoint pair [2];
+  resampler.reset();
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    pair [0] = CSE_TouchPoint (int16_t (20 + (i & 127)), int16_t (150 - (i & 3)), 20, 0);
+    pair [1] = CSE_TouchPoint (int16_t (180 - (i & 63)), int16_t (200 + (i & 7)), 20, 1);
+    pair [0].state = (i == 0) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    pair [1].state = pair [0].state;
+    resampler.update (pair, 2, i * 10000);
+    resampler.sample ((i * 10000) - 5000);
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  volatile int16_t sink = resampler.getPoint (0).x;
+  (void) sink;
+  double ns = std::chrono::duration <double, std::nano> (stop - start).count() / iterations;
+
+  // Attached, a finger that lands and lifts is reported as a touch-down and a lift-off.
+  resampler.reset();
+  tsPanel.attachResampler (&resampler);
+  loadTouches (1);
+  tsPanel.readData();
+  CSE_TouchPoint landed = tsPanel.getPoint (0);
+  loadTouches (0);
+  tsPanel.readData();
+  tsPanel.attachResampler (NULL);
+  resampler.sample (tsPanel.getFrameTime());
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_DOWN) || (resampler.getPoint (0) != landed);
+  resampler.sample (tsPanel.getFrameTime());
+  wrong = wrong || (resampler.getPoint (0).state != FT62XX_TOUCH_UP);
+
+  wrong = wrong || (resampledJudder > (rawJudder / 2)) || (ns > 500.0);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s judder %.2f px (newest frame %.2f), %.0f ns/frame  %s\n",
+    "resampler: 69 Hz scan, 60 Hz", resampledJudder, rawJudder, ns, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Runs a tap, a double-tap, a long-press, a swipe, a pinch and a rotation through
+  the gesture recognizer at 100 frames per second, and checks that each is recognized
+  once with the expected velocity, scale and angle.
+*/
+static void measureGestures (void) {
+  FT6206_SimPoint a = { 100, 100, 0, 0, 20, 1 };
+  FT6206_SimPoint b = { 0, 0, 0, 1, 20, 1 };
+  gestureLength = 0;
+
+  // Tap, then a second tap 100 ms later.
+  addGestureFrames (6, &a, NULL);
+  addGestureFrames (10, NULL, NULL);
+  a.x += 3;
+  addGestureFrames (6, &a, NULL);
+  addGestureFrames (40, NULL, NULL);
+
+  // Long-press for 800 ms.
+  a = { 50, 200, 0, 0, 20, 1 };
+  addGestureFrames (80, &a, NULL);
+  addGestureFrames (40, NULL, NULL);
+
+  // Swipe right by 160 pixels in 80 ms.
+  a = { 30, 150, 0, 0, 20, 1 };
+
+  for (int i = 0; i < 9; i++) {
+    addGestureFrames (1, &a, NULL);
+    a.x += 20;
+  }
+
+  addGestureFrames (40, NULL, NULL);
+
+  // Pinch out from 40 to 120 pixels apart.
+  a = { 100, 160, 0, 0, 20, 1 };
+  b = { 140, 160, 0, 1, 20, 1 };
+
+  for (int i = 0; i < 11; i++) {
+    addGestureFrames (1, &a, &b);
+    a.x -= 4;
+    b.x += 4;
+  }
+
+  addGestureFrames (20, NULL, NULL);
+
+  // Rotate a 40 pixel radius pair by 90 degrees around (120, 160).
+  for (int i = 0; i <= 18; i++) {
+    double angle = (i * 5.0) * 3.14159265358979 / 180.0;
+    int16_t dx = int16_t (lround (40.0 * cos (angle)));
+    int16_t dy = int16_t (lround (40.0 * sin (angle)));
+    a = { uint16_t (120 - dx), uint16_t (160 - dy), 0, 0, 20, 1 };
+    b = { uint16_t (120 + dx), uint16_t (160 + dy), 0, 1, 20, 1 };
+    addGestureFrames (1, &a, &b);
+  }
+
+  addGestureFrames (20, NULL, NULL);
+
+  CSE_FT6206_Gesture gesture;
+  CSE_FT6206_GestureEvent event;
+  CSE_FT6206_GestureEvent swipe, pinch, rotate;
+  uint32_t counts [6] = { 0, 0, 0, 0, 0, 0 };
+
+  swipe = pinch = rotate = CSE_FT6206_GestureEvent();
+  sim.loadScript (gestureScript, gestureLength);
+  tsPanel.attachGesture (&gesture);
+
+  while (sim.step()) {
+    tsPanel.update();
+
+    while (gesture.popEvent (event)) {
+      counts [event.type]++;
+      swipe = (event.type == FT6206_GESTURE_SWIPE) ? event : swipe;
+      pinch = (event.type == FT6206_GESTURE_PINCH) ? event : pinch;
+      rotate = (event.type == FT6206_GESTURE_ROTATE) ? event : rotate;
+    }
+
+    delay (10);
+  }
+
+  tsPanel.attachGesture (NULL);
+
+  bool wrong = (counts [FT6206_GESTURE_TAP] != 1) || (counts [FT6206_GESTURE_DOUBLE_TAP] != 1) ||
+    (counts [FT6206_GESTURE_LONG_PRESS] != 1) || (counts [FT6206_GESTURE_SWIPE] != 1) ||
+    (counts [FT6206_GESTURE_PINCH] == 0) || (counts [FT6206_GESTURE_ROTATE] == 0) ||
+    (swipe.direction != FT6206_SWIPE_RIGHT) || (swipe.vx < 1500) || (swipe.vx > 2500) ||
+    (abs (pinch.scale - (3 * 65536)) > 3277) || (abs (rotate.angle - 9000) > 500);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u frames, tap %u double %u long %u swipe %u (%ld px/s) pinch %u (x%.2f) rotate %u (%.1f deg)  %s\n",
+    "gestures", (unsigned) gestureLength, (unsigned) counts [0], (unsigned) counts [1], (unsigned) counts [2],
+    (unsigned) counts [3], (long) swipe.vx, (unsigned) counts [4], pinch.scale / 65536.0,
+    (unsigned) counts [5], rotate.angle / 100.0, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Runs a touch that rests, jitters by one pixel, moves and lifts, with a hysteresis
+  of 2 pixels. Checks that only the touch-down, the moves and the lift-up are reported as
+  changes, and that the dirty rectangle of a move spans the old and new positions.
+*/
+static void measureChangeDetection (void) {
+  FT6206_SimPoint a = { 100, 100, 0, 0, 20, 1 };
+  gestureLength = 0;
+
+  addGestureFrames (20, &a, NULL);
+
+  for (int i = 0; i < 20; i++) {
+    a.x = uint16_t (100 + (i & 1));
+    a.y = uint16_t (100 - ((i >> 1) & 1));
+    addGestureFrames (1, &a, NULL);
+  }
+
+  for (int i = 1; i <= 5; i++) {
+    a.x = uint16_t (100 + (i * 10));
+    a.y = 100;
+    addGestureFrames (1, &a, NULL);
+  }
+
+  addGestureFrames (10, NULL, NULL);
+
+  uint32_t changedFrames = 0;
+  bool wrongRect = false;
+  int16_t lastX = 100;
+
+  tsPanel.setHysteresis (2);
+  sim.loadScript (gestureScript, gestureLength);
+
+  while (sim.step()) {
+    tsPanel.update();
+
+    if (tsPanel.getChangedMask() != 0) {
+      changedFrames++;
+      CSE_FT6206_Rect rect = tsPanel.getDirtyRect();
+      CSE_TouchPoint point = tsPanel.getPoint (0);
+
+      // A move spans from the previous position to the new one.
+      if ((point.state == FT62XX_TOUCH_CONTACT) && ((rect.x1 != lastX) || (rect.x2 != point.x) || (rect.y1 != 100) || (rect.y2 != 100))) {
+        wrongRect = true;
+      }
+
+      lastX = point.x;
+    }
+    else if (tsPanel.getDirtyRect().x2 >= tsPanel.getDirtyRect().x1) {
+      wrongRect = true;
+    }
+
+    delay (10);
+  }
+
+  tsPanel.setHysteresis();
+  bool wrong = (changedFrames != 7) || wrongRect;
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u frames, %u changed (expected 7)  %s\n", "changes: rest, jitter, move",
+    (unsigned) gestureLength, (unsigned) changedFrames, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Reads one touch at a raw controller position through the panel.
+
+  @returns The point after the transform.
+*/
+static CSE_TouchPoint mapRawPoint (uint16_t x, uint16_t y) {
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+  frame.touches = 1;
+  frame.points [0] = { x, y, 0, 0, 20, 1 };
+  sim.setFrame (frame);
+  tsPanel.readData();
+  return tsPanel.getPoint (0);
+}
+
+/**
+  @brief  Checks the precomputed transform against the switch of rotation formulas it
+  replaced, at the panel corners and a few interior points, for every rotation. Then checks
+  one mirror, one scale and one offset case. The scale maps a 320 x 480 controller to the
+  240 x 320 display, so its last raw row and column must round to width - 1 and height - 1.
+*/
+static void checkTransform (void) {
+  static const uint16_t raw [8][2] = {
+    { 0, 0 }, { 239, 0 }, { 0, 319 }, { 239, 319 }, { 1, 1 }, { 120, 160 }, { 37, 291 }, { 200, 45 }
+  };
+  uint16_t checked = 0;
+  uint16_t mismatches = 0;
+
+  for (uint8_t r = 0; r < 4; r++) {
+    tsPanel.setRotation (r);
+    int16_t w = int16_t (tsPanel.getWidth());
+    int16_t h = int16_t (tsPanel.getHeight());
+
+    for (uint8_t i = 0; i < 8; i++) {
+      int16_t x = int16_t (raw [i][0]);
+      int16_t y = int16_t (raw [i][1]);
+      int16_t ex = x, ey = y;
+
+      // The formulas of the earlier releases.
+      switch (r) {
+        case 1:
+          ex = y;
+          ey = h - x;
+          break;
+        case 2:
+          ex = w - x;
+          ey = h - y;
+          break;
+        case 3:
+          ex = w - y;
+          ey = x;
+          break;
+      }
+
+      CSE_TouchPoint point = mapRawPoint (raw [i][0], raw [i][1]);
+      mismatches += ((point.x != ex) || (point.y != ey)) ? 1 : 0;
+      checked++;
+    }
+  }
+
+  // Mirroring X, then rotating by 1: the mirror is applied in the unrotated display.
+  tsPanel.setRotation (1);
+  tsPanel.setMirror (true, false);
+
+  for (uint8_t i = 0; i < 8; i++) {
+    CSE_TouchPoint point = mapRawPoint (raw [i][0], raw [i][1]);
+    mismatches += ((point.x != int16_t (raw [i][1])) || (point.y != int16_t (raw [i][0]))) ? 1 : 0;
+    checked++;
+  }
+
+  tsPanel.setMirror();
+
+  // A 320 x 480 controller on the 240 x 320 display, rounded to the nearest pixel.
+  tsPanel.setRotation (0);
+  tsPanel.setTouchResolution (320, 480);
+  static const uint16_t scaled [5][2] = { { 0, 0 }, { 319, 479 }, { 2, 3 }, { 161, 250 }, { 318, 1 } };
+
+  for (uint8_t i = 0; i < 5; i++) {
+    int16_t ex = int16_t (((2 * 240 * uint32_t (scaled [i][0])) + 320) / 640);
+    int16_t ey = int16_t (((2 * 320 * uint32_t (scaled [i][1])) + 480) / 960);
+    CSE_TouchPoint point = mapRawPoint (scaled [i][0], scaled [i][1]);
+    mismatches += ((point.x != ex) || (point.y != ey)) ? 1 : 0;
+    checked++;
+  }
+
+  CSE_TouchPoint last = mapRawPoint (319, 479);
+  mismatches += ((last.x != 239) || (last.y != 319)) ? 1 : 0;
+  tsPanel.setTouchResolution();
+
+  // An offset is added after the rotation.
+  tsPanel.setRotation (3);
+  tsPanel.setOffset (5, -7);
+
+  for (uint8_t i = 0; i < 8; i++) {
+    CSE_TouchPoint point = mapRawPoint (raw [i][0], raw [i][1]);
+    mismatches += ((point.x != (int16_t (320 - raw [i][1]) + 5)) || (point.y != (int16_t (raw [i][0]) - 7))) ? 1 : 0;
+    checked++;
+  }
+
+  tsPanel.setOffset();
+  tsPanel.setRotation (0);
+  sim.clearTouches();
+  tsPanel.readData();
+
+  bool wrong = (mismatches != 0);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u points over 4 rotations, mirror, scale and offset, %u wrong  %s\n", "transform: rotation and mapping",
+    (unsigned) checked, (unsigned) mismatches, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Solves a 5-point calibration of a skewed, offset panel with one pixel of noise on
+  the targets, maps a raw touch through the driver, and round-trips the coefficient blob.
+*/
+static void measureCalibration (void) {
+  // Raw points and the targets of tx = 0.9 rx + 0.05 ry + 12, ty = -0.04 rx + 1.1 ry - 8.
+  static const int16_t raw [5][2] = { { 20, 20 }, { 220, 25 }, { 215, 270 }, { 25, 275 }, { 120, 150 } };
+  static const int8_t noise [5][2] = { { 1, 0 }, { -1, 1 }, { 0, -1 }, { 1, 1 }, { -1, 0 } };
+  CSE_FT6206_Calibration calibration;
+  bool wrong = false;
+
+  for (uint8_t i = 0; i < 5; i++) {
+    int16_t tx = int16_t (((900 * raw [i][0]) + (50 * raw [i][1]) + 12000) / 1000) + noise [i][0];
+    int16_t ty = int16_t (((-40 * raw [i][0]) + (1100 * raw [i][1]) - 8000) / 1000) + noise [i][1];
+    calibration.addPoint (tx, ty, raw [i][0], raw [i][1]);
+  }
+
+  wrong = (!calibration.solve()) || (calibration.getMaxError() > 200);
+
+  // A raw touch at (100, 200) should land near (112, 208).
+  tsPanel.setCalibration (calibration.getCoefficients());
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+  frame.touches = 1;
+  frame.points [0] = { 100, 200, 0, 0, 20, 1 };
+  sim.setFrame (frame);
+  tsPanel.readData();
+  CSE_TouchPoint point = tsPanel.getPoint (0);
+  CSE_TouchPoint rawPoint = tsPanel.getRawPoint (0);
+  wrong = wrong || (abs (point.x - 112) > 1) || (abs (point.y - 208) > 1) || (rawPoint.x != 100) || (rawPoint.y != 200);
+  tsPanel.clearCalibration();
+  sim.clearTouches();
+  tsPanel.readData();
+
+  // The blob restores the same coefficients and rejects corruption.
+  uint8_t blob [FT6206_CAL_BLOB_SIZE];
+  CSE_FT6206_Calibration restored;
+  uint8_t size = calibration.serialize (blob, sizeof (blob));
+  wrong = wrong || (size != FT6206_CAL_BLOB_SIZE) || (!restored.deserialize (blob, size)) ||
+    (memcmp (&restored.getCoefficients(), &calibration.getCoefficients(), sizeof (CSE_FT6206_Affine)) != 0);
+  blob [7] ^= 0x01;
+  wrong = wrong || restored.deserialize (blob, size);
+
+  // Collinear points cannot be solved.
+  CSE_FT6206_Calibration collinear;
+  collinear.addPoint (0, 0, 0, 0);
+  collinear.addPoint (10, 10, 10, 10);
+  collinear.addPoint (20, 20, 20, 20);
+  wrong = wrong || collinear.solve();
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s max %u.%02u px rms %u.%02u px, blob %u bytes  %s\n", "calibration: 5 points",
+    calibration.getMaxError() / 100, calibration.getMaxError() % 100,
+    calibration.getRmsError() / 100, calibration.getRmsError() % 100, (unsigned) size,
+    wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Overwrites the public touch count with a value the controller never reports, and
+  checks that the adaptive reads, blocking and split-phase, stay within one frame and
+  decode the frame on the bus.
+*/
+static void checkTouchCountClamp (void) {
+  loadTouches (1);
+  tsPanel.readData();
+  CSE_TouchPoint expected = tsPanel.getPoint (0);
+
+  // Each read gets a new frame, so that it is decoded and not skipped as a repeat.
+  loadTouches (2);
+  tsPanel.readData();
+  loadTouches (1);
+  Wire.resetStats();
+  tsPanel.touches = 200;
+  bool read = tsPanel.readData();
+  HostWireStats stats = Wire.getStats();
+  bool wrong = !read || (tsPanel.touches != 1) || (tsPanel.getPoint (0) != expected) ||
+    (stats.bytes > (FT62XX_FRAME_LENGTH + 3));
+
+  loadTouches (2);
+  tsPanel.touches = 255;
+  bool started = tsPanel.startRead();
+  bool complete = tsPanel.isReadComplete();
+  wrong = wrong || !started || !complete || (tsPanel.touches != 2);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s touches 200 read %u bytes, touches 255 split-phase decoded %u  %s\n", "adaptive read: bad touch count",
+    (unsigned) stats.bytes, (unsigned) tsPanel.touches, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Checks that the setters and applyProfile() report a register that does not take
+  the written value, and that a getter whose shadow cannot be read falls back to a direct
+  read, or returns 0 with an error, instead of the shadow. Also checks that the power mode
+  follows a switch made by the controller itself, and that a profile does not write it.
+*/
+static void checkConfigReadback (void) {
+  CSE_FT6206_Profile profile;
+  bool okBefore = tsPanel.setActiveScanRate (10) && (tsPanel.getActiveScanRate() == 10);
+
+  sim.setWritable (FT62XX_REG_PERIODACTIVE, false);
+  bool setterFails = !tsPanel.setActiveScanRate (12);
+  tsPanel.getProfile (profile);
+  profile.periodActive = 14;
+  bool profileFails = !tsPanel.applyProfile (profile);
+  bool shadowTrue = (tsPanel.getActiveScanRate() == sim.regs [FT62XX_REG_PERIODACTIVE]);
+  sim.setWritable (FT62XX_REG_PERIODACTIVE, true);
+
+  CSE_FT6206 cold (240, 320, &Wire);
+  sim.failNextWrites (FT6206_DEFAULT_I2C_RETRIES + 1);
+  bool direct = (cold.getActiveScanRate() == sim.regs [FT62XX_REG_PERIODACTIVE]) && (cold.getLastError() == FT6206_I2C_OK);
+  sim.failNextWrites (2 * (FT6206_DEFAULT_I2C_RETRIES + 1));
+  bool failed = (cold.getActiveScanRate() == 0) && (cold.getLastError() == FT6206_I2C_DATA_NACK);
+  sim.failNextWrites (0);
+
+  tsPanel.getProfile (profile);
+  sim.regs [FT62XX_REG_PWR_MODE] = FT62XX_PWR_MONITOR;  // Entered by the automatic monitor mode
+  bool powerLive = (tsPanel.getPowerMode() == FT62XX_PWR_MONITOR);
+  profile.threshold++;
+  powerLive = powerLive && tsPanel.applyProfile (profile) && (sim.regs [FT62XX_REG_PWR_MODE] == FT62XX_PWR_MONITOR);
+  profile.threshold--;
+  tsPanel.applyProfile (profile);
+  sim.regs [FT62XX_REG_PWR_MODE] = FT62XX_PWR_ACTIVE;
+
+  bool wrong = !(okBefore && setterFails && profileFails && shadowTrue && direct && failed && powerLive);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %s\n", "readback: read-only register", wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+/**
+  @brief  Pin hook that models a slave holding SDA low. It releases SDA after the given
+  number of SCL pulses, or never if the count is 0.
+*/
+static uint8_t stuckPulses = 0;
+static uint8_t sclPulses = 0;
+
+static void stuckBusHook (uint8_t pin, uint8_t level, void *context) {
+  (void) context;
+
+  if ((pin != BENCH_PIN_SCL) || (level != LOW)) {
+    return;
+  }
+
+  sclPulses++;
+
+  if ((stuckPulses != 0) && (sclPulses == stuckPulses)) {
+    hostHoldPinLow (BENCH_PIN_SDA, false);
+    Wire.setBusStuck (false);
+  }
+}
+
+/**
+  @brief  Checks that a failed frame leaves the snapshot untouched, and that a stuck bus is
+  recovered with SCL pulses, or failed without further attempts if SDA stays low.
+*/
+static void checkBusErrors (void) {
+  // A dropped frame must not reach the snapshot.
+  loadTouches (1);
+  tsPanel.readData();
+  uint32_t seq = tsPanel.getFrameSeq();
+  int16_t x = tsPanel.getPoint (0).x;
+
+  tsPanel.resetI2CStats();
+  sim.regs [FT62XX_REG_P1_XL] ^= 0x40;
+  sim.failNextWrites (FT6206_DEFAULT_I2C_RETRIES + 1);
+  bool dropped = !tsPanel.readData() && (tsPanel.getFrameSeq() == seq) && (tsPanel.getPoint (0).x == x) &&
+    (tsPanel.getLastError() == FT6206_I2C_DATA_NACK);
+  CSE_FT6206_I2CStats stats = tsPanel.getI2CStats();
+  dropped = dropped && (stats.failures == 1) && (stats.droppedFrames == 1) && (stats.retries == FT6206_DEFAULT_I2C_RETRIES);
+  bool recovered = tsPanel.readData() && (tsPanel.getPoint (0).x != x);
+
+  // SDA is released after 3 pulses.
+  uint32_t clock = Wire.getClock();
+  tsPanel.setBusRecovery (BENCH_PIN_SDA, BENCH_PIN_SCL, 400000);
+  hostSetPinHook (stuckBusHook, nullptr);
+  tsPanel.resetI2CStats();
+  stuckPulses = 3;
+  sclPulses = 0;
+  hostHoldPinLow (BENCH_PIN_SDA, true);
+  Wire.setBusStuck (true);
+  bool unstuck = tsPanel.readData() && (sclPulses == 3) && (tsPanel.getI2CStats().recoveries == 1) &&
+    (tsPanel.getI2CStats().busErrors == 1) && (Wire.getClock() == 400000);
+
+  // SDA is never released; the transfer gives up after one recovery.
+  tsPanel.resetI2CStats();
+  stuckPulses = 0;
+  sclPulses = 0;
+  hostHoldPinLow (BENCH_PIN_SDA, true);
+  Wire.setBusStuck (true);
+  bool stuck = !tsPanel.readData() && (sclPulses == FT6206_BUS_RECOVERY_CLOCKS) &&
+    (tsPanel.getLastError() == FT6206_I2C_BUS_STUCK);
+  stats = tsPanel.getI2CStats();
+  stuck = stuck && (stats.recoveries == 1) && (stats.failures == 1) && (stats.droppedFrames == 1);
+
+  hostHoldPinLow (BENCH_PIN_SDA, false);
+  Wire.setBusStuck (false);
+  hostSetPinHook (nullptr, nullptr);
+  tsPanel.setBusRecovery (-1, -1);
+  Wire.setClock (clock);
+  tsPanel.resetI2CStats();
+
+  const bool results [] = { dropped && recovered, unstuck, stuck };
+  const char *names [] = { "bus errors: frame dropped", "bus errors: SDA released", "bus errors: SDA stuck" };
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if ((!results [i]) && checkBudgets) {
+      failures++;
+    }
+
+    printf ("%-32s %s\n", names [i], results [i] ? "ok" : "WRONG");
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Polls four panels behind a TCA9548A, two on each channel, in the round-robin
+  mode and checks that a round switches each channel once and that every panel gets the
+  same frame rate. Then drives two interrupt panels in the priority mode, and checks that
+  a budget of one read per tick starves the lower priority panel and that the frame rates
+  show it.
+*/
+static void measureScheduler (void) {
+  TCA9548A_Sim muxSim;
+  FT6206_Sim panelSims [4];
+  CSE_FT6206_Mux mux (&Wire);
+  CSE_FT6206 panels [4] = {
+    CSE_FT6206 (240, 320, &Wire), CSE_FT6206 (240, 320, &Wire),
+    CSE_FT6206 (240, 320, &Wire), CSE_FT6206 (240, 320, &Wire)
+  };
+
+  // The panel directly on the bus would answer for all of them.
+  sim.setPresent (false);
+  Wire.attachDevice (&muxSim);
+
+  for (uint8_t i = 0; i < 4; i++) {
+    Wire.attachDevice (&panelSims [i]);
+    muxSim.attachDownstream (i % 2, &panelSims [i]);
+    loadTouches (panelSims [i], 1);
+    panels [i].attachMux (&mux, i % 2);
+  }
+
+  // Round-robin over polled panels.
+  CSE_FT6206_Scheduler scheduler (FT6206_SCHEDULE_ROUND_ROBIN);
+
+  for (uint8_t i = 0; i < 4; i++) {
+    scheduler.addPanel (&panels [i]);
+  }
+
+  scheduler.run (4);
+  measure ("scheduler: 4 panels, 1 round", [&scheduler] { scheduler.run (4); });
+
+  mux.resetSwitches();
+  scheduler.resetStats();
+
+  // The loop runs every 10 ms, whatever the bus time.
+  uint32_t next = millis();
+
+  for (uint8_t t = 0; t < 100; t++) {
+    scheduler.run (4);
+    next += 10;
+    delay (next - millis());
+  }
+
+  scheduler.run (0);
+  bool fair = (mux.getSwitches() == 200);
+
+  for (uint8_t i = 0; i < 4; i++) {
+    fair = fair && (scheduler.getFrameCount (i) == 100) && (scheduler.getFrameRate (i) >= 95) &&
+      (scheduler.getFrameRate (i) <= 105);
+  }
+
+  if ((!fair) && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u rounds, %u mux switches, %u/%u/%u/%u fps  %s\n", "scheduler: round-robin",
+    100, (unsigned) mux.getSwitches(), scheduler.getFrameRate (0), scheduler.getFrameRate (1),
+    scheduler.getFrameRate (2), scheduler.getFrameRate (3), fair ? "ok" : "WRONG");
+
+  // Priority over two interrupt panels, one per channel.
+  CSE_FT6206_Frame bufferA [4], bufferB [4];
+  CSE_FT6206_FrameQueue queueA (bufferA, 4), queueB (bufferB, 4);
+  CSE_FT6206 panelA (240, 320, &Wire, -1, BENCH_PIN_INT_A);
+  CSE_FT6206 panelB (240, 320, &Wire, -1, BENCH_PIN_INT_B);
+  CSE_FT6206_Frame frame;
+
+  panelA.attachMux (&mux, 0);
+  panelB.attachMux (&mux, 1);
+  panelSims [0].setInterruptPin (BENCH_PIN_INT_A);
+  panelSims [1].setInterruptPin (BENCH_PIN_INT_B);
+  panelA.beginInterrupt (&queueA);
+  panelB.beginInterrupt (&queueB);
+
+  CSE_FT6206_Scheduler priority (FT6206_SCHEDULE_PRIORITY);
+  priority.addPanel (&panelA, 2);
+  priority.addPanel (&panelB, 1);
+  uint16_t rates [2][2];
+
+  for (uint8_t budget = 1; budget <= 2; budget++) {
+    priority.resetStats();
+    next = millis();
+
+    for (uint8_t t = 0; t < 100; t++) {
+      panelSims [0].pulseInterrupt();
+      panelSims [1].pulseInterrupt();
+      priority.run (budget);
+
+      while (queueA.pop (frame)) {}
+      while (queueB.pop (frame)) {}
+
+      next += 10;
+      delay (next - millis());
+    }
+
+    priority.run (0);
+
+    rates [budget - 1][0] = priority.getFrameRate (0);
+    rates [budget - 1][1] = priority.getFrameRate (1);
+  }
+
+  panelA.endInterrupt();
+  panelB.endInterrupt();
+
+  bool starved = (rates [0][0] >= 95) && (rates [0][1] == 0) && (rates [1][0] >= 95) && (rates [1][1] >= 95);
+
+  if ((!starved) && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s budget 1: %u/%u fps, budget 2: %u/%u fps  %s\n", "scheduler: priority", rates [0][0],
+    rates [0][1], rates [1][0], rates [1][1], starved ? "ok" : "WRONG");
+
+  Wire.detachDevices();
+  Wire.attachDevice (&sim);
+  sim.setPresent (true);
+}
+
+//============================================================================================//
+/**
+  @brief  Pin hook that resets the simulator when the library pulses the reset pin.
+*/
+static void resetPinHook (uint8_t pin, uint8_t level, void *context) {
+  if ((pin == BENCH_PIN_RST) && (level == LOW)) {
+    static_cast <FT6206_Sim *> (context)->hardReset();
+  }
+}
+
+/**
+  @brief  Drives the power manager through a session: idle, a drag that pauses every other
+  20 ms, a rest, a lift, a long idle into the monitor mode and hibernation, and a wake.
+  Checks the scan rate written in each phase, that the pauses do not make the rate flap,
+  that the lift counts as movement,
+  that nothing is read during hibernation and that the configuration survives the wake.
+  The number of host reads is compared with polling at the moving interval all the time.
+*/
+static void measurePower (void) {
+  const uint32_t session = 18000;
+  CSE_FT6206_Power power (&tsPanel);
+  FT6206_SimFrame frame;
+  uint32_t reads = 0;
+  uint8_t rateMoving = 0, rateResting = 0, rateLifted = 0, stateMonitor = 0;
+
+  power.setIdleTimes (FT6206_DEFAULT_MOVE_HOLD_MS, FT6206_DEFAULT_MONITOR_MS, 15000);
+  hostSetPinHook (resetPinHook, &sim);
+  sim.clearTouches();
+  tsPanel.setThreshold (40);
+  tsPanel.readData();
+  tsPanel.resetI2CStats();
+  bool ok = power.begin();
+  uint32_t start = millis();
+
+  for (uint32_t t = 0; t < session; t += 2) {
+    // Drag from 200 to 600 ms, moving only in every other 20 ms, rest until 2000 ms.
+    memset (&frame, 0, sizeof (frame));
+
+    if ((t >= 200) && (t < 2000)) {
+      uint32_t moved = (t < 600) ? (((t - 200) / 40) * 20) + (((t - 200) % 40 < 20) ? ((t - 200) % 40) : 20) : 200;
+      frame.touches = 1;
+      frame.points [0].x = uint16_t (20 + moved);
+      frame.points [0].y = 100;
+      frame.points [0].weight = 20;
+      frame.points [0].event = (t < 210) ? FT62XX_TOUCH_DOWN : FT62XX_TOUCH_CONTACT;
+    }
+
+    if (!sim.isHibernating()) {
+      sim.setFrame (frame);
+    }
+
+    if (power.isPollDue()) {
+      tsPanel.update();
+      reads++;
+    }
+
+    power.update();
+    rateMoving = (t == 580) ? sim.regs [FT62XX_REG_PERIODACTIVE] : rateMoving;
+    rateResting = (t == 1800) ? sim.regs [FT62XX_REG_PERIODACTIVE] : rateResting;
+    rateLifted = (t == 2100) ? sim.regs [FT62XX_REG_PERIODACTIVE] : rateLifted;
+    stateMonitor = (t == 10000) ? power.getState() : stateMonitor;
+
+    // The loop runs every 2 ms, whatever the bus time.
+    int32_t wait = int32_t ((start + t + 2) - millis());
+    delay ((wait > 0) ? uint32_t (wait) : 0);
+  }
+
+  bool hibernated = (power.getState() == FT6206_POWER_HIBERNATE) && sim.isHibernating();
+  uint32_t transitions = power.getTransitions();
+  bool quiet = (tsPanel.getI2CStats().failures == 0);
+
+  // Wake and wait for the initialization.
+  bool woke = power.wake();
+
+  for (uint32_t t = 0; (t < 1000) && (power.getState() != FT6206_POWER_ACTIVE); t++) {
+    power.update();
+    hostAdvanceMicros (1000);
+  }
+
+  woke = woke && (power.getState() == FT6206_POWER_ACTIVE) && (sim.regs [FT62XX_REG_TH_GROUP] == 40) &&
+    (sim.regs [FT62XX_REG_PERIODACTIVE] == FT6206_DEFAULT_STILL_RATE);
+
+  hostSetPinHook (nullptr, nullptr);
+  tsPanel.setThreshold();
+
+  ok = ok && (rateMoving == FT6206_DEFAULT_MOVING_RATE) && (rateResting == FT6206_DEFAULT_STILL_RATE) &&
+    (rateLifted == FT6206_DEFAULT_MOVING_RATE) && (stateMonitor == FT6206_POWER_MONITOR) && (transitions == 6) &&
+    hibernated && quiet && woke;
+
+  if ((!ok) && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s rate %u -> %u, lift %u, %u transitions, %u reads (%u at fixed rate)  %s\n", "power: drag, idle, hibernate",
+    rateMoving, rateResting, rateLifted, (unsigned) transitions, (unsigned) reads,
+    (unsigned) (session / FT6206_DEFAULT_MOVING_POLL_MS), ok ? "ok" : "WRONG");
+}
+
+//============================================================================================//
+/**
+  @brief  Lets the hibernation fall due while the panel is still moving after a lift, with
+  the controller refusing every write. Checks that the manager leaves the moving state
+  once, that the hibernation is tried once per monitor poll interval instead of on every
+  update(), and that it hibernates when the writes are taken again.
+*/
+static void checkPowerRetry (void) {
+  const uint32_t window = 200;
+  CSE_FT6206_Power power (&tsPanel);
+  FT6206_SimFrame frame;
+
+  power.setIdleTimes (FT6206_DEFAULT_MOVE_HOLD_MS, FT6206_DEFAULT_MONITOR_MS, 100);
+  hostSetPinHook (resetPinHook, &sim);
+  sim.clearTouches();
+  tsPanel.readData();
+  bool ok = power.begin();
+
+  // A tap, so that the lift starts the moving state.
+  memset (&frame, 0, sizeof (frame));
+  frame.touches = 1;
+  frame.points [0].x = 100;
+  frame.points [0].y = 100;
+  frame.points [0].weight = 20;
+  frame.points [0].event = FT62XX_TOUCH_DOWN;
+  sim.setFrame (frame);
+  tsPanel.update();
+  power.update();
+  sim.clearTouches();
+  tsPanel.update();
+  power.update();
+  ok = ok && (power.getState() == FT6206_POWER_MOVING);
+
+  uint32_t transitions = power.getTransitions();
+  sim.failNextWrites (255);
+  tsPanel.resetI2CStats();
+
+  for (uint32_t t = 0; t < window; t += 2) {
+    hostAdvanceMicros (2000);
+    power.update();
+  }
+
+  uint32_t tries = tsPanel.getI2CStats().failures;
+  bool left = (power.getState() == FT6206_POWER_ACTIVE) && ((power.getTransitions() - transitions) == 1);
+
+  // The scan rate write and the first attempt, then one attempt per monitor poll interval.
+  bool backedOff = (tries <= (2 + (window / FT6206_DEFAULT_MONITOR_POLL_MS)));
+
+  sim.failNextWrites (0);
+
+  for (uint32_t t = 0; (t < 1000) && (power.getState() != FT6206_POWER_HIBERNATE); t++) {
+    power.update();
+    hostAdvanceMicros (1000);
+  }
+
+  bool hibernated = (power.getState() == FT6206_POWER_HIBERNATE) && sim.isHibernating();
+  bool woke = power.wake();
+
+  for (uint32_t t = 0; (t < 1000) && (power.getState() != FT6206_POWER_ACTIVE); t++) {
+    power.update();
+    hostAdvanceMicros (1000);
+  }
+
+  woke = woke && (power.getState() == FT6206_POWER_ACTIVE);
+  hostSetPinHook (nullptr, nullptr);
+  tsPanel.resetI2CStats();
+
+  ok = ok && left && backedOff && hibernated && woke;
+
+  if ((!ok) && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u failed writes in %u ms, moving left %s, hibernated %s  %s\n", "power: failed hibernation",
+    (unsigned) tries, (unsigned) window, left ? "once" : "no", hibernated ? "later" : "never", ok ? "ok" : "WRONG");
+}
+
+//============================================================================================//
+/**
+  @brief  Compares the compile-time configured driver with the full driver on the same
+  frames, one point without features at rotation 0 and two points with all features at
+  rotation 1, and reports their bus cost and size.
+*/
+static void measureLite (void) {
+  CSE_FT6206_Lite <1, 0, 0> lite1 (240, 320);
+  CSE_FT6206_Lite <2, 1> lite2 (240, 320);
+  bool wrong = (!lite1.begin()) || (!lite2.begin());
+
+  loadTouches (2);
+  tsPanel.setRotation (0);
+  tsPanel.readData();
+  measure ("lite readData() 1 point", [&] { lite1.readData(); });
+
+  CSE_TouchPoint full = tsPanel.getPoint (0);
+  CSE_TouchPoint lite = lite1.getPoint (0);
+  wrong = wrong || (lite1.getTouches() != 1) || (lite.x != full.x) || (lite.y != full.y) || (lite.z != 0) ||
+    (lite.state != full.state) || (lite.id != full.id);
+
+  tsPanel.setRotation (1);
+  tsPanel.readData();
+  measure ("lite readData() 2 points", [&] { lite2.readData(); });
+
+  wrong = wrong || (lite2.getTouches() != 2) || (lite2.getGestureID() != tsPanel.getGestureID()) ||
+    (lite2.getWidth() != tsPanel.getWidth()) || (lite2.getHeight() != tsPanel.getHeight());
+
+  for (uint8_t n = 0; n < 2; n++) {
+    full = tsPanel.getPoint (n);
+    lite = lite2.getPoint (n);
+    wrong = wrong || (lite.x != full.x) || (lite.y != full.y) || (lite.z != full.z) || (lite.state != full.state) ||
+      (lite.id != full.id) || (lite2.getArea (n) != tsPanel.touchArea [n]);
+  }
+
+  tsPanel.setRotation (0);
+  wrong = wrong || (sizeof (lite1) >= sizeof (lite2));
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s <1, 0, none> %u bytes, <2, 1, all> %u bytes, CSE_FT6206 %u bytes  %s\n", "lite: object size",
+    (unsigned) sizeof (lite1), (unsigned) sizeof (lite2), (unsigned) sizeof (CSE_FT6206), wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+
+#define BENCH_DECODE_FRAMES  4096
+
+static uint8_t decodeFrames [BENCH_DECODE_FRAMES * FT62XX_FRAME_LENGTH];
+static int16_t decodeX [2][2][BENCH_DECODE_FRAMES], decodeY [2][2][BENCH_DECODE_FRAMES], decodeZ [2][2][BENCH_DECODE_FRAMES];
+static uint8_t decodeState [2][2][BENCH_DECODE_FRAMES], decodeID [2][2][BENCH_DECODE_FRAMES], decodeArea [2][2][BENCH_DECODE_FRAMES];
+static uint8_t decodeTouches [2][BENCH_DECODE_FRAMES], decodeGesture [2][BENCH_DECODE_FRAMES];
+
+/**
+  @brief  Points the structure of arrays at one of the two sets of decode buffers.
+*/
+static CSE_FT6206_PointArrays decodeArrays (uint8_t set) {
+  CSE_FT6206_PointArrays out;
+
+  for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+    out.x [n] = decodeX [set][n];
+    out.y [n] = decodeY [set][n];
+    out.z [n] = decodeZ [set][n];
+    out.state [n] = decodeState [set][n];
+    out.id [n] = decodeID [set][n];
+    out.area [n] = decodeArea [set][n];
+  }
+
+  out.touches = decodeTouches [set];
+  out.gesture = decodeGesture [set];
+  return out;
+}
+
+/**
+  @brief  Decodes pseudo-random frames one at a time and in a batch, and checks that both
+  give the same fields, and that they match the points the driver decodes from the same
+  registers. Reports the host decode rates.
+*/
+static void measureDecoder (void) {
+  uint32_t seed = 12345;
+
+  for (uint32_t i = 0; i < sizeof (decodeFrames); i++) {
+    seed = (seed * 1103515245UL) + 12345UL;
+    decodeFrames [i] = uint8_t (seed >> 16);
+  }
+
+  // Frames 0 and 1 are real frames read from the simulator.
+  uint8_t raw [FT62XX_FRAME_LENGTH];
+  CSE_TouchPoint driverPoints [2][2];
+
+  for (uint8_t f = 0; f < 2; f++) {
+    loadTouches (f + 1);
+    tsPanel.setReadStrategy (FT62XX_READ_FULL);
+    tsPanel.readData();
+    tsPanel.setReadStrategy();
+    tsPanel.readRegisters (FT62XX_REG_DEV_MODE, raw, FT62XX_FRAME_LENGTH);
+    memcpy (&decodeFrames [f * FT62XX_FRAME_LENGTH], raw, FT62XX_FRAME_LENGTH);
+    driverPoints [f][0] = tsPanel.getRawPoint (0);
+    driverPoints [f][1] = tsPanel.getRawPoint (1);
+  }
+
+  CSE_FT6206_PointArrays single = decodeArrays (0);
+  CSE_FT6206_PointArrays batch = decodeArrays (1);
+
+  for (uint32_t f = 0; f < BENCH_DECODE_FRAMES; f++) {
+    CSE_FT6206_Decoder:: decode (&decodeFrames [f * FT62XX_FRAME_LENGTH], FT62XX_FRAME_LENGTH, single, f);
+  }
+
+  CSE_FT6206_Decoder:: decodeBatch (decodeFrames, BENCH_DECODE_FRAMES, batch);
+
+  bool wrong = (memcmp (decodeTouches [0], decodeTouches [1], BENCH_DECODE_FRAMES) != 0) ||
+    (memcmp (decodeGesture [0], decodeGesture [1], BENCH_DECODE_FRAMES) != 0) ||
+    (memcmp (decodeX [0], decodeX [1], sizeof (decodeX [0])) != 0) ||
+    (memcmp (decodeY [0], decodeY [1], sizeof (decodeY [0])) != 0) ||
+    (memcmp (decodeZ [0], decodeZ [1], sizeof (decodeZ [0])) != 0) ||
+    (memcmp (decodeState [0], decodeState [1], sizeof (decodeState [0])) != 0) ||
+    (memcmp (decodeID [0], decodeID [1], sizeof (decodeID [0])) != 0) ||
+    (memcmp (decodeArea [0], decodeArea [1], sizeof (decodeArea [0])) != 0);
+
+  for (uint8_t f = 0; f < 2; f++) {
+    wrong = wrong || (decodeTouches [1][f] != (f + 1));
+
+    for (uint8_t n = 0; n <= f; n++) {
+      const CSE_TouchPoint &point = driverPoints [f][n];
+      wrong = wrong || (decodeX [1][n][f] != point.x) || (decodeY [1][n][f] != point.y) ||
+        (decodeZ [1][n][f] != point.z) || (decodeState [1][n][f] != point.state) || (decodeID [1][n][f] != point.id);
+    }
+  }
+
+  // A short adaptive frame marks the points that were not read.
+  CSE_FT6206_Decoder:: decode (decodeFrames, FT62XX_REG_P1_XH + 6, single, 0);
+  wrong = wrong || (decodeState [0][1][0] != FT62XX_TOUCH_NONE) || (decodeX [0][1][0] != 0);
+
+  const uint32_t loops = 200;
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < loops; i++) {
+    for (uint32_t f = 0; f < BENCH_DECODE_FRAMES; f++) {
+      CSE_FT6206_Decoder:: decode (&decodeFrames [f * FT62XX_FRAME_LENGTH], FT62XX_FRAME_LENGTH, single, f);
+    }
+  }
+
+  auto middle = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < loops; i++) {
+    CSE_FT6206_Decoder:: decodeBatch (decodeFrames, BENCH_DECODE_FRAMES, batch);
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  double frames = double (BENCH_DECODE_FRAMES) * loops;
+  double singleRate = frames / std::chrono::duration <double> (middle - start).count();
+  double batchRate = frames / std::chrono::duration <double> (stop - middle).count();
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u frames, decode() %.0f M frames/s, decodeBatch() %.0f M frames/s  %s\n", "decoder: single and batch",
+    (unsigned) BENCH_DECODE_FRAMES, singleRate / 1e6, batchRate / 1e6, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+
+#define BENCH_HIT_TARGETS 31
+
+static CSE_FT6206_Rect hitRects [BENCH_HIT_TARGETS];
+static uint8_t hitLayers [BENCH_HIT_TARGETS];
+static bool hitUsed [BENCH_HIT_TARGETS];
+
+/**
+  @brief  The reference hit test: scans every target and keeps the topmost one, with the
+  target added last on top within a layer. Target n has the ID n + 1.
+*/
+static uint8_t linearFind (int16_t x, int16_t y) {
+  int16_t best = -1;
+
+  for (uint8_t n = 0; n < BENCH_HIT_TARGETS; n++) {
+    const CSE_FT6206_Rect &rect = hitRects [n];
+
+    if (!hitUsed [n] || (x < rect.x1) || (x > rect.x2) || (y < rect.y1) || (y > rect.y2)) {
+      continue;
+    }
+
+    if ((best < 0) || (hitLayers [n] >= hitLayers [best])) {
+      best = n;
+    }
+  }
+
+  return (best < 0) ? FT6206_HIT_NONE : uint8_t (best + 1);
+}
+
+/**
+  @brief  Compares the index with the reference at every pixel of the display and a margin
+  around it.
+
+  @returns The number of pixels where they differ.
+*/
+static uint32_t compareHits (CSE_FT6206_HitTest &index, int16_t width, int16_t height) {
+  uint32_t errors = 0;
+
+  for (int16_t y = -8; y < (height + 8); y++) {
+    for (int16_t x = -8; x < (width + 8); x++) {
+      errors += (index.find (x, y) != linearFind (x, y)) ? 1 : 0;
+    }
+  }
+
+  return errors;
+}
+
+/**
+  @brief  Builds a screen of 28 buttons under a dialog with two buttons of its own, and
+  checks the index against a linear scan over every pixel, after removing and moving
+  targets, after a rotation, and when attached to the panel. Reports the host lookup times.
+*/
+static void measureHitTest (void) {
+  CSE_FT6206_HitTest index (240, 320);
+  bool wrong = false;
+
+  // 4 x 7 buttons of 52 x 38 pixels, then the dialog and its buttons on higher layers.
+  for (uint8_t n = 0; n < 28; n++) {
+    int16_t x = 8 + ((n % 4) * 58), y = 8 + ((n / 4) * 44);
+    hitRects [n] = { x, y, int16_t (x + 51), int16_t (y + 37) };
+    hitLayers [n] = 0;
+  }
+
+  hitRects [28] = { 20, 90, 219, 229 };
+  hitLayers [28] = 1;
+  hitRects [29] = { 30, 190, 119, 219 };
+  hitLayers [29] = 2;
+  hitRects [30] = { 120, 190, 209, 219 };
+  hitLayers [30] = 2;
+
+  for (uint8_t n = 0; n < BENCH_HIT_TARGETS; n++) {
+    hitUsed [n] = index.add (n + 1, hitRects [n], hitLayers [n]);
+    wrong = wrong || !hitUsed [n];
+  }
+
+  // A duplicate ID and an empty rectangle are refused.
+  CSE_FT6206_Rect empty = { 10, 10, 9, 10 };
+  wrong = wrong || index.add (1, hitRects [0]) || index.add (200, empty) || (index.getCount() != BENCH_HIT_TARGETS);
+  wrong = wrong || (compareHits (index, 240, 320) != 0);
+
+  const uint32_t loops = 20;
+  uint32_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < loops; i++) {
+    for (int16_t y = 0; y < 320; y++) {
+      for (int16_t x = 0; x < 240; x++) {
+        sum += index.find (x, y);
+      }
+    }
+  }
+
+  auto middle = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < loops; i++) {
+    for (int16_t y = 0; y < 320; y++) {
+      for (int16_t x = 0; x < 240; x++) {
+        sum -= linearFind (x, y);
+      }
+    }
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  double lookups = 240.0 * 320.0 * loops;
+  double gridTime = std::chrono::duration <double, std::nano> (middle - start).count() / lookups;
+  double linearTime = std::chrono::duration <double, std::nano> (stop - middle).count() / lookups;
+  wrong = wrong || (sum != 0);
+
+  // Closing the dialog and moving a button only updates the cells they cover.
+  for (uint8_t n = 28; n < BENCH_HIT_TARGETS; n++) {
+    hitUsed [n] = !index.remove (n + 1);
+  }
+
+  hitRects [5] = { 150, 250, 229, 309 };
+  wrong = wrong || !index.move (6, hitRects [5]) || index.remove (28 + 1) || index.move (99, hitRects [5]);
+  wrong = wrong || (index.getCount() != 28) || (compareHits (index, 240, 320) != 0);
+
+  // After a rotation the same targets are spread over the new grid.
+  index.setBounds (320, 240);
+  wrong = wrong || (compareHits (index, 320, 240) != 0);
+  index.setBounds (240, 320);
+
+  // Attached, the index resolves the points of every frame.
+  tsPanel.attachHitTest (&index);
+  loadTouches (1);
+  tsPanel.readData();
+  CSE_TouchPoint point = tsPanel.getPoint (0);
+  wrong = wrong || (index.getHit (0) == FT6206_HIT_NONE) || (index.getHit (0) != linearFind (point.x, point.y)) ||
+    (index.getHit (1) != FT6206_HIT_NONE);
+  loadTouches (0);
+  tsPanel.readData();
+  tsPanel.attachHitTest (NULL);
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u targets, find() %.1f ns, linear scan %.1f ns  %s\n", "hit test: every pixel",
+    (unsigned) BENCH_HIT_TARGETS, gridTime, linearTime, wrong ? "WRONG" : "ok");
+}
+
+//============================================================================================//
+
+static uint8_t streamed [4096];
+static uint32_t streamedLength = 0;
+
+static void streamWriter (const uint8_t *data, uint8_t length) {
+  if ((streamedLength + length) <= sizeof (streamed)) {
+    memcpy (&streamed [streamedLength], data, length);
+  }
+
+  streamedLength += length;
+}
+
+/**
+  @brief  Returns a checksum of the touch count and the present points in the snapshot of
+  a panel.
+*/
+static uint32_t snapshotSum (CSE_FT6206 &panel) {
+  uint32_t sum = panel.touches;
+
+  for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+    CSE_TouchPoint point = panel.touchPoints [n];
+
+    if (point.state == FT62XX_TOUCH_NONE) {
+      continue;
+    }
+
+    sum = (sum * 31) + uint32_t (point.x);
+    sum = (sum * 31) + uint32_t (point.y);
+    sum = (sum * 31) + point.state;
+  }
+
+  return sum;
+}
+
+/**
+  @brief  Records a rest, a drag, a pinch and a lift-up read through the 1-Euro filter into
+  a RAM ring, and replays the trace through a second panel that is never on the bus.
+  Checks that the replay gives the same filtered points in every frame, that streaming the
+  replayed frames again gives the same bytes, and that a small ring keeps a readable tail
+  of the trace. Reports the size per frame and the host replay rate.
+*/
+static void measureTrace (void) {
+  FT6206_SimPoint a = { 100, 150, 0, 0, 24, 1 };
+  FT6206_SimPoint b = { 140, 150, 0, 1, 24, 1 };
+  gestureLength = 0;
+
+  addGestureFrames (30, &a, NULL);
+
+  for (int i = 0; i < 40; i++) {
+    a.x = uint16_t (a.x + 3);
+    a.y = uint16_t (a.y + (i & 1));
+    addGestureFrames (1, &a, NULL);
+  }
+
+  for (int i = 0; i < 40; i++) {
+    a.x = uint16_t (a.x - 1);
+    b.x = uint16_t (a.x + 40 + (i * 2));
+    addGestureFrames (1, &a, &b);
+  }
+
+  addGestureFrames (20, NULL, NULL);
+
+  static uint8_t ring [2048];
+  static uint8_t smallRing [64];
+  static uint8_t trace [2048];
+  static uint32_t liveSums [320];
+  CSE_FT6206_Trace recorder (ring, sizeof (ring));
+  CSE_FT6206_Trace smallRecorder (smallRing, sizeof (smallRing));
+  CSE_FT6206_Filter liveFilter, replayFilter;
+  CSE_FT6206 replayPanel (240, 320);
+  uint32_t frames = 0;
+
+  recorder.start();
+  smallRecorder.start();
+  tsPanel.attachFilter (&liveFilter);
+  tsPanel.attachTrace (&recorder);
+  sim.loadScript (gestureScript, gestureLength);
+
+  while (sim.step()) {
+    uint8_t raw [FT62XX_FRAME_LENGTH];
+    tsPanel.readData();
+    tsPanel.readRegisters (FT62XX_REG_DEV_MODE, raw, FT62XX_FRAME_LENGTH);
+    smallRecorder.record (tsPanel.getFrameTime(), raw, FT62XX_FRAME_LENGTH);
+    liveSums [frames++] = snapshotSum (tsPanel);
+    delay (10);
+  }
+
+  tsPanel.attachTrace (NULL);
+  tsPanel.attachFilter (NULL);
+  recorder.stop();
+
+  // Replay through a panel that never touches the bus.
+  uint32_t length = recorder.copyTo (trace, sizeof (trace));
+  CSE_FT6206_TraceReader reader (trace, length);
+  bool wrong = (!reader.begin()) || (recorder.getFrameCount() != frames) || (recorder.getDroppedCount() != 0);
+  uint32_t replayed = 0;
+  uint32_t transactions = Wire.getStats().transactions;
+
+  replayPanel.attachFilter (&replayFilter);
+
+  while (replayPanel.replay (reader)) {
+    wrong = wrong || (replayed >= frames) || (snapshotSum (replayPanel) != liveSums [replayed]);
+    replayed++;
+  }
+
+  wrong = wrong || (replayed != frames) || (!reader.isComplete()) || (Wire.getStats().transactions != transactions);
+
+  // Recording the replayed frames again as a stream gives the same bytes.
+  CSE_FT6206_Trace streamer (streamWriter);
+  uint8_t raw [FT6206_TRACE_MAX_FRAME];
+  uint8_t rawLength = 0;
+  uint32_t time = 0;
+
+  streamedLength = 0;
+  streamer.start();
+  reader.begin();
+
+  while (reader.next (time, raw, rawLength)) {
+    streamer.record (time, raw, rawLength);
+  }
+
+  wrong = wrong || (streamedLength != length) || (memcmp (streamed, trace, length) != 0);
+
+  // The small ring keeps the last frames, and its trace ends with the last frame read.
+  uint32_t smallLength = smallRecorder.copyTo (trace, sizeof (trace));
+  CSE_FT6206_TraceReader tail (trace, smallLength);
+  uint32_t tailFrames = 0;
+  tail.begin();
+
+  while (tail.next (time, raw, rawLength)) {
+    tailFrames++;
+  }
+
+  wrong = wrong || (smallRecorder.getDroppedCount() == 0) || (tailFrames != smallRecorder.getFrameCount()) ||
+    (!tail.isComplete()) || (time != tsPanel.getFrameTime()) || (raw [FT62XX_REG_TD_STATUS] != 0);
+
+  // Host replay rate, without the filter so that the decoding path dominates.
+  const uint32_t loops = 2000;
+  replayPanel.attachFilter (NULL);
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < loops; i++) {
+    reader.begin();
+
+    while (replayPanel.replay (reader)) {
+    }
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration <double> (stop - start).count();
+  double rate = (double (frames) * loops) / seconds;
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u frames, %u bytes (%.1f per frame), %.1f M frames/s  %s\n", "trace: record and replay",
+    (unsigned) frames, (unsigned) length, double (length) / frames, rate / 1e6, wrong ? "WRONG" : "ok");
+  printf ("%-32s %u frames kept, %u dropped, %u bytes\n", "trace: 64 byte ring",
+    (unsigned) smallRecorder.getFrameCount(), (unsigned) smallRecorder.getDroppedCount(), (unsigned) smallLength);
+}
+
+//============================================================================================//
+/**
+  @brief  Reads 100 frames at 100 Hz with the finger moving in every other frame, drops one
+  frame, reads one point 10 times and services 10 interrupts 300 us after the edge. Checks
+  every counter of the metrics against the script and the bytes against the bus.
+*/
+#ifdef CSE_FT6206_METRICS
+static void measureMetrics (void) {
+  CSE_FT6206_Metrics metrics;
+  CSE_FT6206_Frame buffer [4];
+  CSE_FT6206_FrameQueue queue (buffer, 4);
+  FT6206_SimFrame frame;
+  CSE_FT6206_Frame popped;
+
+  loadTouches (1);
+  tsPanel.readData();
+  tsPanel.resetMetrics();
+  Wire.resetStats();
+  uint32_t next = millis();
+
+  for (uint8_t i = 0; i < 100; i++) {
+    if ((i % 2) == 0) {
+      memset (&frame, 0, sizeof (frame));
+      frame.touches = 1;
+      frame.points [0].x = uint16_t (110 + i);
+      frame.points [0].y = 150;
+      frame.points [0].weight = 24;
+      frame.points [0].event = FT62XX_TOUCH_CONTACT;
+      sim.setFrame (frame);
+    }
+
+    tsPanel.readData();
+    next += 10;
+    delay (next - millis());
+  }
+
+  sim.failNextWrites (FT6206_DEFAULT_I2C_RETRIES + 1);
+  tsPanel.readData();
+
+  for (uint8_t i = 0; i < 10; i++) {
+    tsPanel.fastReadData (0);
+  }
+
+  tsPanel.getMetrics (metrics);
+  uint16_t frameRate = metrics.frameRate;
+  tsPanel.beginInterrupt (&queue);
+
+  for (uint8_t i = 0; i < 10; i++) {
+    sim.pulseInterrupt();
+    hostAdvanceMicros (300);
+    tsPanel.service();
+    queue.pop (popped);
+  }
+
+  tsPanel.endInterrupt();
+  tsPanel.getMetrics (metrics);
+  HostWireStats stats = Wire.getStats();
+  uint32_t reads = 0, fastReads = 0, interrupts = 0;
+
+  for (uint8_t n = 0; n < FT6206_METRICS_BUCKETS; n++) {
+    reads += metrics.readLatency [n];
+    fastReads += metrics.fastReadLatency [n];
+    interrupts += metrics.interruptLatency [n];
+  }
+
+  bool ok = (metrics.readCalls == 111) && (metrics.frames == 110) && (metrics.duplicateFrames == 60) &&
+    (metrics.droppedFrames == 1) && (metrics.fastReadCalls == 10) && (reads == 111) && (fastReads == 10) &&
+    (interrupts == 10) && (metrics.maxInterruptLatency >= 300) && (metrics.bytes == stats.bytes) &&
+    (frameRate >= 95) && (frameRate <= 105);
+
+  if ((!ok) && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u fps, read p50 %u us p99 %u us, int p99 %u us, %u dup %u drop, %u bytes  %s\n",
+    "metrics: 100 Hz drag", frameRate, (unsigned) CSE_FT6206:: getPercentile (metrics.readLatency, 50),
+    (unsigned) CSE_FT6206:: getPercentile (metrics.readLatency, 99),
+    (unsigned) CSE_FT6206:: getPercentile (metrics.interruptLatency, 99), (unsigned) metrics.duplicateFrames,
+    (unsigned) metrics.droppedFrames, (unsigned) metrics.bytes, ok ? "ok" : "WRONG");
+}
+#endif
+
+//============================================================================================//
+/**
+  @brief  Checks the records of a two-finger frame and of a failed read, and that a full
+  ring keeps the newest records and counts the lost ones. Prints a formatted frame and
+  reports the host time of one record.
+*/
+#ifdef CSE_FT6206_LOG
+static void measureLog (void) {
+  CSE_FT6206_Log &log = tsPanel.getLog();
+  CSE_FT6206_LogRecord records [8];
+  uint8_t count = 0;
+  bool wrong = false;
+
+  loadTouches (2);
+  tsPanel.setReadStrategy (FT62XX_READ_FULL);
+  tsPanel.readData();
+  log.clear();
+  loadTouches (1);
+  tsPanel.readData();
+
+  while ((count < 8) && log.drain (records [count])) {
+    count++;
+  }
+
+  // The read of the frame, the frame and its two points, the second one lifting.
+  CSE_TouchPoint point = tsPanel.getPoint (0);
+  wrong = wrong || (count != 4) || (records [0].event != FT6206_LOG_READ) || (records [0].reg != FT62XX_REG_DEV_MODE) ||
+    ((records [0].value >> 8) != FT62XX_FRAME_LENGTH) || (records [1].event != FT6206_LOG_FRAME) || (records [1].reg != 1) ||
+    (records [2].event != FT6206_LOG_POINT) || (records [2].value != ((uint32_t (uint16_t (point.y)) << 16) | uint16_t (point.x))) ||
+    (records [3].event != FT6206_LOG_POINT) || ((records [3].reg >> 7) != 1);
+
+  char line [FT6206_LOG_TEXT_LENGTH];
+
+  for (uint8_t i = 0; i < count; i++) {
+    CSE_FT6206_Log:: format (records [i], line, sizeof (line));
+    printf ("  %s\n", line);
+  }
+
+  // A read that fails after all retries.
+  sim.failNextWrites (FT6206_DEFAULT_I2C_RETRIES + 1);
+  tsPanel.readData();
+  wrong = wrong || !log.drain (records [0]) || (records [0].event != FT6206_LOG_ERROR) ||
+    (records [0].reg != FT62XX_REG_DEV_MODE) || (records [0].value != tsPanel.getLastError()) || log.drain (records [1]);
+
+  // Unchanged frames are not decoded, so each read logs one record.
+  for (uint8_t i = 0; i < 40; i++) {
+    tsPanel.readData();
+  }
+
+  wrong = wrong || (log.getCount() != FT6206_LOG_ENTRIES) || (log.getLostCount() != (40 - FT6206_LOG_ENTRIES)) ||
+    !log.drain (records [0]) || (records [0].event != FT6206_LOG_READ);
+  tsPanel.setReadStrategy();
+
+  const uint32_t iterations = 1000000;
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    log.record (FT6206_LOG_READ, uint8_t (i), i);
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration <double, std::nano> (stop - start).count() / iterations;
+  log.clear();
+
+  if (wrong && checkBudgets) {
+    failures++;
+  }
+
+  printf ("%-32s %u entries of %u bytes, %.1f ns/record  %s\n", "log: frame, error, overflow",
+    (unsigned) FT6206_LOG_ENTRIES, (unsigned) sizeof (CSE_FT6206_LogRecord), ns, wrong ? "WRONG" : "ok");
+}
+#endif
+
+//============================================================================================//
+
+int main (int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp (argv [i], "--check") == 0) {
+      checkBudgets = true;
+    }
+  }
+
+  hostReset();
+  Wire.attachDevice (&sim);
+  sim.setInterruptPin (BENCH_PIN_INT);
+  Wire.begin();
+  tsPanel.begin();
+
+  printf ("%-32s %6s %6s %6s %10s %10s %10s\n", "case", "xfers", "bytes", "bits",
+    "us@100k", "us@400k", "us@1M");
+
+  printf ("-- 0 finger(s) down\n");
+  loadTouches (0);
+  tsPanel.readData();
+  measure ("readData() idle", [] { tsPanel.readData(); });
+
+  printf ("-- 1 finger(s) down\n");
+  loadTouches (1);
+  measure ("readData() touch down", [] { tsPanel.readData(); });
+  measure ("readData()", [] { tsPanel.readData(); });
+  measure ("update()", [] { tsPanel.update(); });
+  measure ("fastReadData(0)", [] { tsPanel.fastReadData (0); });
+  measure ("getPoint(0)", [] { tsPanel.getPoint (0); });
+  measure ("isTouched(0)", [] { tsPanel.isTouched (uint8_t (0)); });
+  measure ("getTouches()", [] { tsPanel.getTouches(); });
+  measure ("getGestureName()", [] { tsPanel.getGestureName(); });
+  measure ("example: readTouch() 1 finger", exampleReadTouch);
+
+  // Every accessor re-reads the bus when the staleness budget is zero.
+  tsPanel.setMaxFrameAge (0);
+  measure ("getPoint(0) max age 0", [] { tsPanel.getPoint (0); });
+  measure ("readTouch() 1 finger max age 0", exampleReadTouch);
+  tsPanel.setMaxFrameAge();
+
+  tsPanel.setReadStrategy (FT62XX_READ_FULL);
+  measure ("readData() full read", [] { tsPanel.readData(); });
+  tsPanel.setReadStrategy (FT62XX_READ_ADAPTIVE);
+
+  printf ("-- 2 finger(s) down\n");
+  loadTouches (2);
+  tsPanel.readData();
+  measure ("readData() 2 fingers", [] { tsPanel.readData(); });
+  measure ("example: readTouch() 2 fingers", exampleReadTouch);
+  checkTouchCountClamp();
+
+  printf ("-- configuration\n");
+  measure ("refreshConfig()", [] { tsPanel.refreshConfig(); });
+  measure ("getActiveScanRate()", [] { tsPanel.getActiveScanRate(); });
+  measure ("getInterruptMode()", [] { tsPanel.getInterruptMode(); });
+  measure ("setActiveScanRate()", [] { tsPanel.setActiveScanRate (8); });
+  measure ("applyProfile() unchanged", [] {
+    CSE_FT6206_Profile profile;
+    tsPanel.getProfile (profile);
+    tsPanel.applyProfile (profile);
+  });
+  measure ("applyProfile() 3 registers", [] {
+    CSE_FT6206_Profile profile;
+    tsPanel.getProfile (profile);
+    profile.threshold = 40;
+    profile.periodActive = 12;
+    profile.periodMonitor = 30;
+    tsPanel.applyProfile (profile);
+  });
+  checkConfigReadback();
+
+  printf ("-- bus errors\n");
+  loadTouches (1);
+  tsPanel.readData();
+  measure ("readData() 1 NACK retried", [] {
+    sim.failNextWrites (1);
+    tsPanel.readData();
+  });
+  measure ("readData() 3 NACKs dropped", [] {
+    sim.failNextWrites (FT6206_DEFAULT_I2C_RETRIES + 1);
+    tsPanel.readData();
+  });
+  measure ("readData() short read retried", [] {
+    sim.shortenNextReads (1);
+    tsPanel.readData();
+  });
+  checkBusErrors();
+
+  printf ("-- transports\n");
+  measureTransport();
+  measureSplitRead();
+
+  printf ("-- initialization\n");
+  measureAsyncBegin();
+  checkIdentify();
+
+  printf ("-- touch events\n");
+  measureTracker();
+
+  printf ("-- filters\n");
+  measureFilter ("filter: none", FT6206_FILTER_NONE);
+  measureFilter ("filter: median3", FT6206_FILTER_MEDIAN3);
+  measureFilter ("filter: ema", FT6206_FILTER_EMA);
+  measureFilter ("filter: 1-euro", FT6206_FILTER_ONE_EURO);
+
+  printf ("-- prediction\n");
+  measurePredictor();
+
+  printf ("-- resampling\n");
+  measureResampler();
+
+  printf ("-- gestures\n");
+  measureGestures();
+
+  printf ("-- change detection\n");
+  measureChangeDetection();
+
+  printf ("-- coordinate transform\n");
+  checkTransform();
+
+  printf ("-- calibration\n");
+  measureCalibration();
+
+  printf ("-- multiple panels\n");
+  measureScheduler();
+
+  printf ("-- power management\n");
+  measurePower();
+  checkPowerRetry();
+
+  printf ("-- compile-time driver\n");
+  measureLite();
+
+  printf ("-- stateless decoder\n");
+  measureDecoder();
+
+  printf ("-- hit test\n");
+  measureHitTest();
+
+  printf ("-- trace replay\n");
+  measureTrace();
+
+  #ifdef CSE_FT6206_METRICS
+    printf ("-- metrics\n");
+    measureMetrics();
+  #endif
+
+  #ifdef CSE_FT6206_LOG
+    printf ("-- event log\n");
+    measureLog();
+  #endif
+
+  printf ("-- interrupt frame queue\n");
+  measureInterruptQueue ("queue: consumer keeps up", 1);
+  measureInterruptQueue ("queue: consumer stalls 16", 16);
+  checkMergedEdges();
+
+  if (checkBudgets) {
+    printf ("%s: %d case(s) over budget\n", (failures == 0) ? "PASS" : "FAIL", failures);
+  }
+
+  return (failures == 0) ? 0 : 1;
+}
+
+//============================================================================================//
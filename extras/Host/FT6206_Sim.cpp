@@ -0,0 +1,226 @@
+//============================================================================================//
+/*
+  Filename: FT6206_Sim.cpp
+  Description: Register-level simulator of the FT6206 touch controller for host builds.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "FT6206_Sim.h"
+
+//============================================================================================//
+
+FT6206_Sim:: FT6206_Sim (uint8_t address) {
+  this->address = address;
+  pinInterrupt = -1;
+  script = nullptr;
+  scriptLength = 0;
+  scriptIndex = 0;
+  failWrites = 0;
+  shortReads = 0;
+  powerOn();
+  resetReadCounts();
+}
+
+//============================================================================================//
+/**
+  @brief  Loads the register defaults of an FT6206 after reset.
+*/
+void FT6206_Sim:: powerOn (void) {
+  memset (regs, 0x00, sizeof (regs));
+  pointer = 0;
+
+  regs [0x80] = 0x16; // TH_GROUP
+  regs [0x85] = 0xA0; // TH_DIFF
+  regs [0x86] = 0x01; // CTRL, switch to monitor mode automatically
+  regs [0x87] = 0x02; // TIMEENTERMONITOR
+  regs [0x88] = 0x06; // PERIODACTIVE
+  regs [0x89] = 0x28; // PERIODMONITOR
+  regs [0x91] = 0x0A; // RADIAN_VALUE
+  regs [0x92] = 0x19; // OFFSET_LEFT_RIGHT
+  regs [0x93] = 0x19; // OFFSET_UP_DOWN
+  regs [0x94] = 0x19; // DISTANCE_LEFT_RIGHT
+  regs [0x95] = 0x19; // DISTANCE_UP_DOWN
+  regs [0x96] = 0x32; // DISTANCE_ZOOM
+  regs [0xA1] = 0x30; // LIB_VERSION_H
+  regs [0xA2] = 0x03; // LIB_VERSION_L
+  regs [0xA3] = 0x06; // CIPHER
+  regs [0xA4] = 0x01; // G_MODE, trigger mode
+  regs [0xA5] = 0x00; // PWR_MODE, active
+  regs [0xA6] = 0x10; // FIRMID
+  regs [0xA8] = 0x11; // FOCALTECH_ID
+  regs [0xAF] = 0x01; // RELEASE_CODE_ID
+  regs [0xBC] = 0x01; // STATE, working
+
+  // Only the mode and configuration registers can be written.
+  memset (writable, 0, sizeof (writable));
+  writable [0x00] = true;
+  writable [0x80] = true;
+
+  for (uint8_t reg = 0x85; reg <= 0x89; reg++) {
+    writable [reg] = true;
+  }
+
+  for (uint8_t reg = 0x91; reg <= 0x96; reg++) {
+    writable [reg] = true;
+  }
+
+  writable [0xA4] = true;
+  writable [0xA5] = true;
+
+  clearTouches();
+}
+
+//============================================================================================//
+/**
+  @brief  Makes a register writable or read-only. Use this to model a register that does
+  not accept a write.
+*/
+void FT6206_Sim:: setWritable (uint8_t reg, bool writable) {
+  if (reg < FT6206_SIM_NUM_REGS) {
+    this->writable [reg] = writable;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Writes the touch registers (0x01-0x0E) from a frame. Points beyond the touch
+  count read back as 0xFF, like the real chip, unless they carry a lift-up event. A lifted
+  point keeps its last position in the frame where the touch count drops.
+*/
+void FT6206_Sim:: setFrame (const FT6206_SimFrame &frame) {
+  regs [0x01] = frame.gesture;
+  regs [0x02] = frame.touches;
+
+  for (uint8_t i = 0; i < FT6206_SIM_MAX_POINTS; i++) {
+    uint8_t *p = &regs [0x03 + (i * 6)];
+    const FT6206_SimPoint &point = frame.points [i];
+
+    if ((i >= frame.touches) && (point.event != 0x01)) {
+      memset (p, 0xFF, 6);
+      continue;
+    }
+
+    p [0] = uint8_t ((point.event << 6) | ((point.x >> 8) & 0x0F));
+    p [1] = uint8_t (point.x & 0xFF);
+    p [2] = uint8_t ((point.id << 4) | ((point.y >> 8) & 0x0F));
+    p [3] = uint8_t (point.y & 0xFF);
+    p [4] = point.weight;
+    p [5] = uint8_t (point.area << 4);
+  }
+}
+
+void FT6206_Sim:: clearTouches (void) {
+  FT6206_SimFrame frame;
+  memset (&frame, 0, sizeof (frame));
+  setFrame (frame);
+}
+
+//============================================================================================//
+
+void FT6206_Sim:: loadScript (const FT6206_SimFrame *frames, size_t count) {
+  script = frames;
+  scriptLength = count;
+  scriptIndex = 0;
+}
+
+/**
+  @brief  Applies the next scripted frame and pulses the INT line if a pin is set.
+
+  @returns False if there are no more frames in the script.
+*/
+bool FT6206_Sim:: step (void) {
+  if ((script == nullptr) || (scriptIndex >= scriptLength)) {
+    return false;
+  }
+
+  setFrame (script [scriptIndex++]);
+  pulseInterrupt();
+  return true;
+}
+
+/**
+  @brief  Models a pulse on the reset pin. The registers return to their power-on defaults,
+  and a hibernating chip wakes up.
+*/
+void FT6206_Sim:: hardReset (void) {
+  powerOn();
+  setPresent (true);
+}
+
+void FT6206_Sim:: pulseInterrupt (void) {
+  if (pinInterrupt < 0) {
+    return;
+  }
+
+  hostSetPinLevel (uint8_t (pinInterrupt), LOW);
+  hostSetPinLevel (uint8_t (pinInterrupt), HIGH);
+}
+
+void FT6206_Sim:: resetReadCounts (void) {
+  memset (readCount, 0, sizeof (readCount));
+}
+
+//============================================================================================//
+/**
+  @brief  The first byte of a write sets the register pointer. Any following bytes are
+  written to consecutive registers. Writes to read-only registers are ignored.
+*/
+bool FT6206_Sim:: i2cWrite (const uint8_t *data, size_t length) {
+  if (length == 0) {
+    return true;
+  }
+
+  if (failWrites > 0) {
+    failWrites--;
+    return false;
+  }
+
+  pointer = data [0];
+
+  for (size_t i = 1; i < length; i++) {
+    if ((pointer < FT6206_SIM_NUM_REGS) && writable [pointer]) {
+      regs [pointer] = data [i];
+    }
+    pointer++;
+  }
+
+  // In hibernation the chip stops responding until it is reset.
+  if (regs [0xA5] == 0x03) {
+    setPresent (false);
+  }
+
+  return true;
+}
+
+/**
+  @brief  Reads consecutive registers starting at the register pointer. Registers outside
+  the register file read as 0xFF.
+*/
+size_t FT6206_Sim:: i2cRead (uint8_t *data, size_t length) {
+  if ((shortReads > 0) && (length > 0)) {
+    shortReads--;
+    length--;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    if (pointer < FT6206_SIM_NUM_REGS) {
+      readCount [pointer]++;
+      data [i] = regs [pointer];
+    }
+    else {
+      data [i] = 0xFF;
+    }
+    pointer++;
+  }
+
+  return length;
+}
+
+//============================================================================================//
@@ -0,0 +1,103 @@
+//============================================================================================//
+/*
+  Filename: FT6206_Sim.h
+  Description: Register-level simulator of the FT6206 touch controller for host builds.
+  The register file covers 0x00-0xBC and behaves like the real chip with an auto-incrementing
+  register pointer. Touch frames can be set directly or scripted and stepped through.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef FT6206_SIM_H
+#define FT6206_SIM_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+#define FT6206_SIM_NUM_REGS       0xBD  // Registers 0x00 to 0xBC
+#define FT6206_SIM_MAX_POINTS     2
+
+//============================================================================================//
+/*!
+  @brief  One simulated touch point. The event is one of the FT62XX_TOUCH_* values.
+*/
+struct FT6206_SimPoint {
+  uint16_t x;
+  uint16_t y;
+  uint8_t event;
+  uint8_t id;
+  uint8_t weight;
+  uint8_t area;
+};
+
+//============================================================================================//
+/*!
+  @brief  One scripted frame. Frames are applied in order by step().
+*/
+struct FT6206_SimFrame {
+  uint8_t touches;
+  uint8_t gesture;
+  FT6206_SimPoint points [FT6206_SIM_MAX_POINTS];
+};
+
+//============================================================================================//
+/*!
+  @brief  FT6206 register file simulator.
+*/
+class FT6206_Sim : public HostI2CDevice {
+  public:
+    uint8_t regs [FT6206_SIM_NUM_REGS];
+
+    FT6206_Sim (uint8_t address = 0x38);
+
+    // HostI2CDevice interface.
+
+    uint8_t getAddress (void) const override { return address; }
+    bool i2cWrite (const uint8_t *data, size_t length) override;
+    size_t i2cRead (uint8_t *data, size_t length) override;
+
+    // Simulation control.
+
+    void powerOn (void);  // Loads the power-on register defaults
+    void hardReset (void);  // Reset pin pulse, also wakes the chip from hibernation
+    void setFrame (const FT6206_SimFrame &frame);  // Loads a frame into the touch registers
+    void clearTouches (void); // Loads an idle frame
+    void loadScript (const FT6206_SimFrame *frames, size_t count);
+    bool step (void); // Applies the next scripted frame, returns false at the end
+    size_t getScriptPosition (void) const { return scriptIndex; }
+    void setInterruptPin (int8_t pin) { pinInterrupt = pin; }
+    void pulseInterrupt (void); // Drives the INT line low then high again
+
+    void setWritable (uint8_t reg, bool writable);  // Writes to a read-only register are ignored
+    bool isHibernating (void) const { return !isPresent(); }
+
+    // Fault injection.
+
+    void failNextWrites (uint8_t count) { failWrites = count; } // NACKs the data of the next writes
+    void shortenNextReads (uint8_t count) { shortReads = count; } // Returns one byte less on the next reads
+
+    uint32_t getReadCount (uint8_t reg) const { return (reg < FT6206_SIM_NUM_REGS) ? readCount [reg] : 0; }
+    void resetReadCounts (void);
+
+  private:
+    uint8_t address;
+    uint8_t pointer;  // The register pointer, auto-incremented on every access
+    int8_t pinInterrupt;
+    const FT6206_SimFrame *script;
+    size_t scriptLength;
+    size_t scriptIndex;
+    uint32_t readCount [FT6206_SIM_NUM_REGS];
+    bool writable [FT6206_SIM_NUM_REGS];
+    uint8_t failWrites;
+    uint8_t shortReads;
+};
+
+//============================================================================================//
+
+#endif // FT6206_SIM_H
@@ -0,0 +1,61 @@
+//============================================================================================//
+/*
+  Filename: Posix.cpp
+  Description: Builds the CSE_FT6206 library for Linux without an Arduino core, against
+  the POSIX platform functions, and checks the parts that do not need a device.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include <stdio.h>
+#include <errno.h>
+#include "CSE_FT6206.h"
+
+#if !defined (CSE_FT6206_POSIX)
+  #error "Posix.cpp must be built without the mock Arduino core"
+#endif
+
+//============================================================================================//
+/**
+  @brief  Stand-in for ioctl() on an adapter with nothing connected.
+*/
+static int absentIoctl (int fd, unsigned long request, void *argument) {
+  (void) fd;
+  (void) request;
+  (void) argument;
+  errno = ENXIO;
+  return -1;
+}
+
+//============================================================================================//
+/**
+  @brief  Checks that the clock runs, that a panel and a multiplexer on the i2c-dev
+  transport report the absent device, and that the interrupt mode is refused.
+*/
+int main (void) {
+  CSE_FT6206_LinuxI2C adapter ("/dev/null", absentIoctl);
+  CSE_FT6206 panel (240, 320, &adapter, -1, 5);
+  CSE_FT6206_Mux mux (&adapter);
+  CSE_FT6206_Frame buffer [2];
+  CSE_FT6206_FrameQueue queue (buffer, 2);
+
+  uint32_t start = micros();
+  delay (2);
+  uint32_t elapsed = micros() - start;
+
+  bool wrong = (elapsed < 2000) || panel.begin() || panel.readData() || (panel.getLastError() != FT6206_I2C_ADDRESS_NACK);
+  wrong = wrong || mux.select (1) || (adapter.getLastErrno() != ENXIO) || panel.beginInterrupt (&queue);
+
+  printf ("%-32s delay (2) %u us, absent panel and mux NACK, no interrupt mode  %s\n", "posix build",
+    (unsigned) elapsed, wrong ? "WRONG" : "ok");
+
+  return wrong ? 1 : 0;
+}
+
+//============================================================================================//
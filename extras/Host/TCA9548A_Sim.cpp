@@ -0,0 +1,76 @@
+//============================================================================================//
+/*
+  Filename: TCA9548A_Sim.cpp
+  Description: Simulator of the TCA9548A I2C multiplexer for host builds.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 06:02:51 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "TCA9548A_Sim.h"
+
+//============================================================================================//
+
+TCA9548A_Sim:: TCA9548A_Sim (uint8_t address) {
+  this->address = address;
+  control = 0;
+  writes = 0;
+  numDevices = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Places a device behind a channel. The device is disconnected until the channel
+  is enabled.
+*/
+bool TCA9548A_Sim:: attachDownstream (uint8_t channel, HostI2CDevice *device) {
+  if ((device == nullptr) || (channel >= 8) || (numDevices >= TCA9548A_SIM_MAX_DEVICES)) {
+    return false;
+  }
+
+  channels [numDevices] = channel;
+  devices [numDevices++] = device;
+  route();
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  The byte written is the control register, one bit per channel.
+*/
+bool TCA9548A_Sim:: i2cWrite (const uint8_t *data, size_t length) {
+  if (length == 0) {
+    return true;
+  }
+
+  control = data [length - 1];
+  writes++;
+  route();
+  return true;
+}
+
+/**
+  @brief  Reads return the control register.
+*/
+size_t TCA9548A_Sim:: i2cRead (uint8_t *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    data [i] = control;
+  }
+
+  return length;
+}
+
+//============================================================================================//
+
+void TCA9548A_Sim:: route (void) {
+  for (uint8_t i = 0; i < numDevices; i++) {
+    devices [i]->setPresent ((control & (1 << channels [i])) != 0);
+  }
+}
+
+//============================================================================================//
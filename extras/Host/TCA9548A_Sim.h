@@ -0,0 +1,58 @@
+//============================================================================================//
+/*
+  Filename: TCA9548A_Sim.h
+  Description: Simulator of the TCA9548A I2C multiplexer for host builds. Devices attached
+  to a channel only respond on the bus while their channel is enabled.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 06:02:51 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef TCA9548A_SIM_H
+#define TCA9548A_SIM_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+#define TCA9548A_SIM_MAX_DEVICES  8
+
+//============================================================================================//
+/*!
+  @brief  TCA9548A simulator. The downstream devices must also be attached to the bus.
+*/
+class TCA9548A_Sim : public HostI2CDevice {
+  public:
+    TCA9548A_Sim (uint8_t address = 0x70);
+
+    // HostI2CDevice interface.
+
+    uint8_t getAddress (void) const override { return address; }
+    bool i2cWrite (const uint8_t *data, size_t length) override;
+    size_t i2cRead (uint8_t *data, size_t length) override;
+
+    // Simulation control.
+
+    bool attachDownstream (uint8_t channel, HostI2CDevice *device);  // The device is absent until its channel is enabled
+    uint8_t getControl (void) const { return control; }
+    uint32_t getWrites (void) const { return writes; }
+    void resetWrites (void) { writes = 0; }
+
+  private:
+    uint8_t address;
+    uint8_t control;  // One bit per enabled channel
+    uint32_t writes;
+    uint8_t numDevices;
+    uint8_t channels [TCA9548A_SIM_MAX_DEVICES];
+    HostI2CDevice *devices [TCA9548A_SIM_MAX_DEVICES];
+
+    void route (void);
+};
+
+//============================================================================================//
+
+#endif // TCA9548A_SIM_H
@@ -0,0 +1,225 @@
+//============================================================================================//
+/*
+  Filename: Arduino.cpp
+  Description: Host-side implementation of the minimal Arduino core stand-in.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "Arduino.h"
+#include <stdio.h>
+
+HostSerial Serial;
+
+static uint64_t hostTimeNs = 0;
+static uint8_t pinLevels [HOST_NUM_PINS];
+static uint8_t pinModes [HOST_NUM_PINS];
+static void (*pinIsr [HOST_NUM_PINS]) (void);
+static int pinIsrMode [HOST_NUM_PINS];
+static bool interruptsEnabled = true;
+static bool pinHeldLow [HOST_NUM_PINS];  // Pulled low by a simulated device, like a stuck SDA
+static HostPinHook pinHook = nullptr;
+static void *pinHookContext = nullptr;
+
+//============================================================================================//
+
+uint32_t millis (void) {
+  return uint32_t (hostTimeNs / 1000000ULL);
+}
+
+uint32_t micros (void) {
+  return uint32_t (hostTimeNs / 1000ULL);
+}
+
+void delay (uint32_t ms) {
+  hostAdvanceMicros (uint64_t (ms) * 1000ULL);
+}
+
+void delayMicroseconds (uint32_t us) {
+  hostAdvanceMicros (us);
+}
+
+void yield (void) {
+}
+
+//============================================================================================//
+
+void pinMode (uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_NUM_PINS) {
+    return;
+  }
+
+  pinModes [pin] = mode;
+
+  if (mode == INPUT_PULLUP) {
+    pinLevels [pin] = pinHeldLow [pin] ? LOW : HIGH;
+  }
+}
+
+void digitalWrite (uint8_t pin, uint8_t val) {
+  if (pin >= HOST_NUM_PINS) {
+    return;
+  }
+
+  pinLevels [pin] = (val && !pinHeldLow [pin]) ? HIGH : LOW;
+
+  if (pinHook != nullptr) {
+    pinHook (pin, pinLevels [pin], pinHookContext);
+  }
+}
+
+int digitalRead (uint8_t pin) {
+  if (pin >= HOST_NUM_PINS) {
+    return LOW;
+  }
+
+  return pinLevels [pin];
+}
+
+int digitalPinToInterrupt (uint8_t pin) {
+  return pin;
+}
+
+void attachInterrupt (uint8_t interruptNum, void (*isr) (void), int mode) {
+  if (interruptNum >= HOST_NUM_PINS) {
+    return;
+  }
+
+  pinIsr [interruptNum] = isr;
+  pinIsrMode [interruptNum] = mode;
+}
+
+void detachInterrupt (uint8_t interruptNum) {
+  if (interruptNum >= HOST_NUM_PINS) {
+    return;
+  }
+
+  pinIsr [interruptNum] = nullptr;
+}
+
+void noInterrupts (void) {
+  interruptsEnabled = false;
+}
+
+void interrupts (void) {
+  interruptsEnabled = true;
+}
+
+//============================================================================================//
+
+size_t HostSerial:: print (const char *str) {
+  if (echo) {
+    return (size_t) printf ("%s", str);
+  }
+  return strlen (str);
+}
+
+size_t HostSerial:: print (char c) {
+  if (echo) {
+    putchar (c);
+  }
+  return 1;
+}
+
+size_t HostSerial:: print (long n, int base) {
+  char buf [24];
+  snprintf (buf, sizeof (buf), (base == HEX) ? "%lX" : "%ld", n);
+  return print (buf);
+}
+
+size_t HostSerial:: print (unsigned long n, int base) {
+  char buf [24];
+  snprintf (buf, sizeof (buf), (base == HEX) ? "%lX" : "%lu", n);
+  return print (buf);
+}
+
+size_t HostSerial:: print (double n, int digits) {
+  char buf [32];
+  snprintf (buf, sizeof (buf), "%.*f", digits, n);
+  return print (buf);
+}
+
+//============================================================================================//
+
+void hostReset (void) {
+  hostTimeNs = 0;
+  interruptsEnabled = true;
+  pinHook = nullptr;
+  pinHookContext = nullptr;
+
+  for (int i = 0; i < HOST_NUM_PINS; i++) {
+    pinLevels [i] = HIGH;
+    pinModes [i] = INPUT;
+    pinHeldLow [i] = false;
+    pinIsr [i] = nullptr;
+    pinIsrMode [i] = 0;
+  }
+}
+
+uint64_t hostMicros64 (void) {
+  return hostTimeNs / 1000ULL;
+}
+
+void hostAdvanceMicros (uint64_t us) {
+  hostTimeNs += us * 1000ULL;
+}
+
+void hostAdvanceNanos (uint64_t ns) {
+  hostTimeNs += ns;
+}
+
+void hostSetPinLevel (uint8_t pin, uint8_t level) {
+  if (pin >= HOST_NUM_PINS) {
+    return;
+  }
+
+  uint8_t previous = pinLevels [pin];
+  pinLevels [pin] = level ? HIGH : LOW;
+
+  if ((pinIsr [pin] == nullptr) || (!interruptsEnabled) || (previous == pinLevels [pin])) {
+    return;
+  }
+
+  bool falling = (previous == HIGH) && (pinLevels [pin] == LOW);
+  int mode = pinIsrMode [pin];
+
+  if ((mode == CHANGE) || ((mode == FALLING) && falling) || ((mode == RISING) && !falling)) {
+    pinIsr [pin]();
+  }
+}
+
+void hostHoldPinLow (uint8_t pin, bool hold) {
+  if (pin >= HOST_NUM_PINS) {
+    return;
+  }
+
+  pinHeldLow [pin] = hold;
+
+  if (hold) {
+    pinLevels [pin] = LOW;
+  }
+  else if ((pinModes [pin] == INPUT_PULLUP) || (pinModes [pin] == INPUT)) {
+    pinLevels [pin] = HIGH;
+  }
+}
+
+uint8_t hostGetPinLevel (uint8_t pin) {
+  return (pin < HOST_NUM_PINS) ? pinLevels [pin] : LOW;
+}
+
+uint8_t hostGetPinMode (uint8_t pin) {
+  return (pin < HOST_NUM_PINS) ? pinModes [pin] : INPUT;
+}
+
+void hostSetPinHook (HostPinHook hook, void *context) {
+  pinHook = hook;
+  pinHookContext = context;
+}
+
+//============================================================================================//
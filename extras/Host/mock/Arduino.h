@@ -0,0 +1,132 @@
+//============================================================================================//
+/*
+  Filename: Arduino.h
+  Description: Minimal host-side stand-in for the Arduino core. Provides just enough of the
+  Arduino API for the CSE_FT6206 library to compile and run on a Linux host. Time is
+  virtual and only advances through delay(), bus activity or the host control functions.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+typedef uint8_t byte;
+
+#define HIGH                0x1
+#define LOW                 0x0
+
+#define INPUT               0x0
+#define OUTPUT              0x1
+#define INPUT_PULLUP        0x2
+
+#define CHANGE              1
+#define FALLING             2
+#define RISING              3
+
+#define DEC                 10
+#define HEX                 16
+
+#define constrain(amt, low, high)   ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HOST_NUM_PINS       64  // Number of simulated GPIO pins
+
+//============================================================================================//
+// Timing functions. Time is virtual and starts at zero.
+
+uint32_t millis (void);
+uint32_t micros (void);
+void delay (uint32_t ms);
+void delayMicroseconds (uint32_t us);
+void yield (void);
+
+//============================================================================================//
+// GPIO and interrupt functions.
+
+void pinMode (uint8_t pin, uint8_t mode);
+void digitalWrite (uint8_t pin, uint8_t val);
+int digitalRead (uint8_t pin);
+int digitalPinToInterrupt (uint8_t pin);
+void attachInterrupt (uint8_t interruptNum, void (*isr) (void), int mode);
+void detachInterrupt (uint8_t interruptNum);
+void noInterrupts (void);
+void interrupts (void);
+
+//============================================================================================//
+/*!
+  @brief  A very small subset of the Arduino String class backed by std::string.
+*/
+class String {
+  public:
+    String (const char *str = "") : s (str) {}
+    String (const std::string &str) : s (str) {}
+    const char *c_str (void) const { return s.c_str(); }
+    unsigned int length (void) const { return (unsigned int) s.length(); }
+    bool operator== (const char *rhs) const { return s == rhs; }
+    bool operator== (const String &rhs) const { return s == rhs.s; }
+    bool operator!= (const char *rhs) const { return s != rhs; }
+
+  private:
+    std::string s;
+};
+
+//============================================================================================//
+/*!
+  @brief  Serial port stand-in. Output is discarded unless echo is enabled.
+*/
+class HostSerial {
+  public:
+    bool echo = false;
+
+    void begin (unsigned long baud) { (void) baud; }
+    size_t print (const char *str);
+    size_t print (const String &str) { return print (str.c_str()); }
+    size_t print (char c);
+    size_t print (long n, int base = DEC);
+    size_t print (unsigned long n, int base = DEC);
+    size_t print (int n, int base = DEC) { return print ((long) n, base); }
+    size_t print (unsigned int n, int base = DEC) { return print ((unsigned long) n, base); }
+    size_t print (double n, int digits = 2);
+
+    template <typename T>
+    size_t println (T value) { size_t n = print (value); return n + print ('\n'); }
+
+    template <typename T>
+    size_t println (T value, int format) { size_t n = print (value, format); return n + print ('\n'); }
+
+    size_t println (void) { return print ('\n'); }
+};
+
+extern HostSerial Serial;
+
+//============================================================================================//
+// Host control functions. These are not part of the Arduino API and are only used by the
+// host simulator and benchmarks to drive the virtual world.
+
+typedef void (*HostPinHook) (uint8_t pin, uint8_t level, void *context);
+
+void hostReset (void); // Resets the clock, pins and interrupts
+uint64_t hostMicros64 (void); // Returns the full 64-bit virtual time in microseconds
+void hostAdvanceMicros (uint64_t us); // Advances the virtual clock
+void hostAdvanceNanos (uint64_t ns);  // Advances the virtual clock with sub-microsecond precision
+void hostSetPinLevel (uint8_t pin, uint8_t level);  // Drives an input pin and fires any attached ISR
+void hostHoldPinLow (uint8_t pin, bool hold);  // Holds a line low against the library, like a stuck SDA
+uint8_t hostGetPinLevel (uint8_t pin);
+uint8_t hostGetPinMode (uint8_t pin);
+void hostSetPinHook (HostPinHook hook, void *context); // Called when the library writes a pin
+
+//============================================================================================//
+
+#endif // HOST_ARDUINO_H
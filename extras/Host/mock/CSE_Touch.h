@@ -0,0 +1,40 @@
+//============================================================================================//
+/*
+  Filename: CSE_Touch.h
+  Description: Host-side stand-in for the CSE_Touch library. Only the CSE_TouchPoint class
+  used by CSE_FT6206 is provided.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_Touch
+  Last Modified: +05:30 09:12:40 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef HOST_CSE_TOUCH_H
+#define HOST_CSE_TOUCH_H
+
+#include "Arduino.h"
+
+//============================================================================================//
+/*!
+  @brief  A single touch point.
+*/
+class CSE_TouchPoint {
+  public:
+    int16_t x, y, z;
+    uint8_t state;
+    uint8_t id;
+
+    CSE_TouchPoint (void) : x (0), y (0), z (0), state (0), id (0) {}
+    CSE_TouchPoint (int16_t x, int16_t y, int16_t z, uint8_t id = 0) : x (x), y (y), z (z), state (0), id (id) {}
+
+    bool operator== (const CSE_TouchPoint &p) const { return (x == p.x) && (y == p.y) && (z == p.z); }
+    bool operator!= (const CSE_TouchPoint &p) const { return !(*this == p); }
+};
+
+//============================================================================================//
+
+#endif // HOST_CSE_TOUCH_H
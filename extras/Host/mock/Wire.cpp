@@ -0,0 +1,265 @@
+//============================================================================================//
+/*
+  Filename: Wire.cpp
+  Description: Host-side implementation of the simulated TwoWire class.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 11:15:00 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "Wire.h"
+
+TwoWire Wire;
+
+//============================================================================================//
+
+TwoWire:: TwoWire() {
+  numDevices = 0;
+  clockHz = 100000; // Arduino default
+  begun = false;
+  stopPending = false;
+  busStuck = false;
+  timed = true;
+  txAddress = 0;
+  txLength = 0;
+  transmitting = false;
+  rxLength = 0;
+  rxIndex = 0;
+  resetStats();
+}
+
+//============================================================================================//
+
+void TwoWire:: begin (void) {
+  begun = true;
+}
+
+void TwoWire:: begin (int sda, int scl) {
+  (void) sda;
+  (void) scl;
+  begun = true;
+}
+
+void TwoWire:: end (void) {
+  begun = false;
+}
+
+void TwoWire:: setClock (uint32_t frequency) {
+  if (frequency > 0) {
+    clockHz = frequency;
+  }
+}
+
+//============================================================================================//
+
+void TwoWire:: beginTransmission (uint8_t address) {
+  txAddress = address;
+  txLength = 0;
+  transmitting = true;
+}
+
+size_t TwoWire:: write (uint8_t data) {
+  if ((!transmitting) || (txLength >= HOST_WIRE_BUFFER_SIZE)) {
+    return 0;
+  }
+
+  txBuffer [txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire:: write (const uint8_t *data, size_t length) {
+  size_t n = 0;
+
+  while ((n < length) && write (data [n])) {
+    n++;
+  }
+
+  return n;
+}
+
+/**
+  @brief  Sends the buffered bytes. Returns 0 on success, 2 on address NACK and 3 on data
+  NACK, like the Arduino cores.
+*/
+uint8_t TwoWire:: endTransmission (bool sendStop) {
+  if (!transmitting) {
+    return 4;
+  }
+
+  transmitting = false;
+
+  if (busStuck) {
+    stats.errors++;
+    return 4;
+  }
+
+  accountStart();
+  accountBytes (1); // Address byte
+
+  HostI2CDevice *device = findDevice (txAddress);
+
+  if (device == nullptr) {
+    stats.nacks++;
+    accountStop (true);
+    return 2;
+  }
+
+  accountBytes (uint32_t (txLength));
+  bool ack = device->i2cWrite (txBuffer, txLength);
+
+  if (!ack) {
+    stats.nacks++;
+    accountStop (true);
+    return 3;
+  }
+
+  accountStop (sendStop);
+  return 0;
+}
+
+//============================================================================================//
+
+uint8_t TwoWire:: requestFrom (uint8_t address, uint8_t quantity, uint8_t sendStop) {
+  rxLength = 0;
+  rxIndex = 0;
+
+  if (quantity > HOST_WIRE_BUFFER_SIZE) {
+    quantity = HOST_WIRE_BUFFER_SIZE;
+  }
+
+  if (busStuck) {
+    stats.errors++;
+    return 0;
+  }
+
+  accountStart();
+  accountBytes (1); // Address byte
+
+  HostI2CDevice *device = findDevice (address);
+
+  if (device == nullptr) {
+    stats.nacks++;
+    accountStop (true);
+    return 0;
+  }
+
+  rxLength = device->i2cRead (rxBuffer, quantity);
+  accountBytes (uint32_t (rxLength));
+  accountStop (sendStop != 0);
+
+  return uint8_t (rxLength);
+}
+
+uint8_t TwoWire:: requestFrom (int address, int quantity, int sendStop) {
+  return requestFrom (uint8_t (address), uint8_t (quantity), uint8_t (sendStop));
+}
+
+int TwoWire:: available (void) {
+  return int (rxLength - rxIndex);
+}
+
+int TwoWire:: read (void) {
+  if (rxIndex >= rxLength) {
+    return -1;
+  }
+
+  return rxBuffer [rxIndex++];
+}
+
+int TwoWire:: peek (void) {
+  if (rxIndex >= rxLength) {
+    return -1;
+  }
+
+  return rxBuffer [rxIndex];
+}
+
+//============================================================================================//
+
+bool TwoWire:: attachDevice (HostI2CDevice *device) {
+  if ((device == nullptr) || (numDevices >= HOST_WIRE_MAX_DEVICES)) {
+    return false;
+  }
+
+  devices [numDevices++] = device;
+  return true;
+}
+
+void TwoWire:: detachDevices (void) {
+  numDevices = 0;
+}
+
+void TwoWire:: resetStats (void) {
+  stats.transactions = 0;
+  stats.stops = 0;
+  stats.bytes = 0;
+  stats.bits = 0;
+  stats.nacks = 0;
+  stats.errors = 0;
+}
+
+/**
+  @brief  Converts a number of bit times to microseconds at the given bus clock.
+*/
+double TwoWire:: busTimeMicros (uint32_t bits, uint32_t frequency) {
+  return (double (bits) * 1000000.0) / double (frequency);
+}
+
+//============================================================================================//
+
+HostI2CDevice *TwoWire:: findDevice (uint8_t address) {
+  for (uint8_t i = 0; i < numDevices; i++) {
+    if ((devices [i]->getAddress() == address) && devices [i]->isPresent()) {
+      return devices [i];
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+  @brief  Accounts a START or a repeated START condition.
+*/
+void TwoWire:: accountStart (void) {
+  stats.transactions++;
+  stats.bits += 1;
+
+  if (timed) {
+    hostAdvanceNanos ((1000000000ULL * 1) / clockHz);
+  }
+
+  stopPending = false;
+}
+
+/**
+  @brief  Accounts whole bytes, each of which takes 8 data bits and 1 ACK bit.
+*/
+void TwoWire:: accountBytes (uint32_t count) {
+  stats.bytes += count;
+  stats.bits += count * 9;
+
+  if (timed) {
+    hostAdvanceNanos ((1000000000ULL * 9 * count) / clockHz);
+  }
+}
+
+void TwoWire:: accountStop (bool sendStop) {
+  if (sendStop) {
+    stats.stops++;
+    stats.bits += 1;
+
+    if (timed) {
+      hostAdvanceNanos (1000000000ULL / clockHz);
+    }
+  }
+  else {
+    stopPending = true;
+  }
+}
+
+//============================================================================================//
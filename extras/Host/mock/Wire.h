@@ -0,0 +1,129 @@
+//============================================================================================//
+/*
+  Filename: Wire.h
+  Description: Host-side stand-in for the Arduino TwoWire (I2C) class. Transfers are routed
+  to simulated I2C devices and every transaction is accounted for so that the bus cost of
+  the library can be measured. Each transfer also advances the virtual clock by its
+  modeled duration at the configured bus clock.
+  Framework: Host (Linux, GCC/Clang)
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 11:15:00 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+#define HOST_WIRE_BUFFER_SIZE     128 // Same as the ESP32 core
+#define HOST_WIRE_MAX_DEVICES     8   // Maximum number of simulated devices on one bus
+
+//============================================================================================//
+/*!
+  @brief  Interface implemented by simulated I2C target devices.
+*/
+class HostI2CDevice {
+  public:
+    virtual ~HostI2CDevice() {}
+    virtual uint8_t getAddress (void) const = 0;
+    virtual bool i2cWrite (const uint8_t *data, size_t length) = 0; // Returns false to NACK
+    virtual size_t i2cRead (uint8_t *data, size_t length) = 0;  // Returns the bytes supplied
+
+    void setPresent (bool present) { this->present = present; } // An absent device never ACKs
+    bool isPresent (void) const { return present; }
+
+  private:
+    bool present = true;
+};
+
+//============================================================================================//
+/*!
+  @brief  Bus cost counters. One transaction is one START (or repeated START) followed by
+  an address byte. Bytes include the address bytes. Bits include the START, STOP and
+  ACK/NACK bits, and are used to model the bus time at any clock.
+*/
+struct HostWireStats {
+  uint32_t transactions;  // Number of address phases (START or repeated START)
+  uint32_t stops; // Number of STOP conditions
+  uint32_t bytes; // Address and data bytes on the wire
+  uint32_t bits;  // Total bit times including START, STOP and ACK bits
+  uint32_t nacks; // Number of NACKed address or data bytes
+  uint32_t errors;  // Number of transfers that failed because the bus was stuck
+};
+
+//============================================================================================//
+/*!
+  @brief  Simulated TwoWire.
+*/
+class TwoWire {
+  public:
+    TwoWire();
+
+    // Arduino API.
+
+    void begin (void);
+    void begin (int sda, int scl);
+    void end (void);
+    void setClock (uint32_t frequency);
+    uint32_t getClock (void) const { return clockHz; }
+
+    void beginTransmission (uint8_t address);
+    void beginTransmission (int address) { beginTransmission (uint8_t (address)); }
+    uint8_t endTransmission (bool sendStop = true);
+    size_t write (uint8_t data);
+    size_t write (const uint8_t *data, size_t length);
+
+    uint8_t requestFrom (uint8_t address, uint8_t quantity, uint8_t sendStop = 1);
+    uint8_t requestFrom (int address, int quantity, int sendStop = 1);
+
+    int available (void);
+    int read (void);
+    int peek (void);
+
+    // Host control functions.
+
+    bool attachDevice (HostI2CDevice *device);
+    void detachDevices (void);
+    void resetStats (void);
+    HostWireStats getStats (void) const { return stats; }
+    bool isBegun (void) const { return begun; }
+    void setBusStuck (bool stuck) { busStuck = stuck; } // Every transfer fails until released
+    void setTimed (bool timed) { this->timed = timed; } // False while a background engine owns the bus time
+
+    static double busTimeMicros (uint32_t bits, uint32_t frequency); // Bits to microseconds
+
+  private:
+    HostI2CDevice *devices [HOST_WIRE_MAX_DEVICES];
+    uint8_t numDevices;
+    HostWireStats stats;
+    uint32_t clockHz;
+    bool begun;
+    bool stopPending; // The previous transfer ended without a STOP (repeated START follows)
+    bool busStuck;
+    bool timed; // Transfers advance the virtual clock
+
+    uint8_t txAddress;
+    uint8_t txBuffer [HOST_WIRE_BUFFER_SIZE];
+    size_t txLength;
+    bool transmitting;
+
+    uint8_t rxBuffer [HOST_WIRE_BUFFER_SIZE];
+    size_t rxLength;
+    size_t rxIndex;
+
+    HostI2CDevice *findDevice (uint8_t address);
+    void accountStart (void);
+    void accountBytes (uint32_t count);
+    void accountStop (bool sendStop);
+};
+
+extern TwoWire Wire;
+
+//============================================================================================//
+
+#endif // HOST_WIRE_H
@@ -77,7 +77,7 @@ void loop() {
  */
 void readTouch() {
   // Read all touch data.
-  tsPanel.readData();
+  tsPanel.update();
   // tsPanel.fastReadData (0);
 
   // Print the touch point data.
@@ -9,18 +9,68 @@
   Version: 0.0.3
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_FT6206
-  Last Modified: +05:30 11:31:00 AM 29-03-2025, Saturday
+  Last Modified: +05:30 01:55:48 AM 17-10-2026, Saturday
  */
 //============================================================================================//
 
 #include "CSE_FT6206.h"
 
+// Metrics statements compile to nothing unless CSE_FT6206_METRICS is defined.
+#ifdef CSE_FT6206_METRICS
+  #define FT6206_METRIC(...)              __VA_ARGS__
+#else
+  #define FT6206_METRIC(...)
+#endif
+
+// Event log statements compile to nothing unless CSE_FT6206_LOG is defined.
+#ifdef CSE_FT6206_LOG
+  #define FT6206_LOG(event, reg, value)   eventLog.record ((event), (reg), (value))
+#else
+  #define FT6206_LOG(event, reg, value)
+#endif
+
+CSE_FT6206 *CSE_FT6206:: isrInstances [FT6206_MAX_INTERRUPT_INSTANCES] = { NULL };
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new FT6206 class on an Arduino I2C bus.
+
+  @param  width The width of the unrotated display.
+  @param  height The height of the unrotated display.
+  @param  i2c The bus.
+  @param  pinRst The reset pin, or -1 if it is not connected.
+  @param  pinIrq The interrupt pin, or -1 if it is not connected.
+*/
+#if !defined (CSE_FT6206_POSIX)
+CSE_FT6206:: CSE_FT6206 (uint16_t width, uint16_t height, TwoWire *i2c, int8_t pinRst, int8_t pinIrq) : wireTransport (i2c) {
+  init (width, height, &wireTransport, pinRst, pinIrq);
+}
+#endif
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new FT6206 class on any transport, for example the Linux i2c-dev
+  transport.
+
+  @param  width The width of the unrotated display.
+  @param  height The height of the unrotated display.
+  @param  transport The transport, which must outlive the panel.
+  @param  pinRst The reset pin, or -1 if it is not connected.
+  @param  pinIrq The interrupt pin, or -1 if it is not connected.
+*/
+CSE_FT6206:: CSE_FT6206 (uint16_t width, uint16_t height, CSE_FT6206_Transport *transport, int8_t pinRst, int8_t pinIrq) {
+  init (width, height, transport, pinRst, pinIrq);
+}
+
 //============================================================================================//
 /**
-  @brief  Instantiates a new FT6206 class.
+  @brief  Sets up the state shared by the constructors.
 */
-CSE_FT6206:: CSE_FT6206 (uint16_t width, uint16_t height, TwoWire *i2c, int8_t pinRst, int8_t pinIrq) {
-  wireInstance = i2c;
+void CSE_FT6206:: init (uint16_t width, uint16_t height, CSE_FT6206_Transport *transport, int8_t pinRst, int8_t pinIrq) {
+  this->transport = transport;
+  i2cAddress = FT62XX_I2C_ADDR;
+  mux = NULL;
+  muxChannel = 0;
   pinReset = pinRst;
   pinInterrupt = pinIrq;
 
@@ -39,15 +89,96 @@ CSE_FT6206:: CSE_FT6206 (uint16_t width, uint16_t height, TwoWire *i2c, int8_t p
   }
 
   touches = 0;
+  gestureID = 0;
+
+  for (int i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    touchArea [i] = 0;
+  }
+
+  // No frame has been read yet.
+  frameSeq = 0;
+  frameTime = 0;
+  readStrategy = FT62XX_READ_ADAPTIVE;
+  memset (configShadow, 0, sizeof (configShadow));
+  configValid = false;
+
+  // Transfers are retried, but the bus is not recovered until the pins are set.
+  i2cRetries = FT6206_DEFAULT_I2C_RETRIES;
+  pinSda = -1;
+  pinScl = -1;
+  busClock = 0;
+  lastError = FT6206_I2C_OK;
+  resetI2CStats();
+  FT6206_METRIC (resetMetrics());
+
+  // Interrupt mode is off until beginInterrupt() is called.
+  frameQueue = NULL;
+  framePending = false;
+  interruptTime = 0;
+  interruptCount = 0;
+  servicedEdges = 0;
+  interruptSlot = -1;
+  queuedTouches = 0;
+
+  // No split-phase read is in flight.
+  readPhase = FT6206_READ_IDLE;
+  readStatus = FT6206_I2C_OK;
+  readDeadline = 0;
+  readCallback = NULL;
+
+  // No processing stages are attached.
+  filter = NULL;
+  tracker = NULL;
+  gesture = NULL;
+  hitTest = NULL;
+  predictor = NULL;
+  resampler = NULL;
+  trace = NULL;
+
+  // Nothing has been read yet, so the first frame is always decoded.
+  lastRawLength = 0;
+  hysteresis = FT6206_DEFAULT_HYSTERESIS;
+  changedMask = 0;
+  dirtyRect.x1 = 0;
+  dirtyRect.y1 = 0;
+  dirtyRect.x2 = -1;
+  dirtyRect.y2 = -1;
+
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    reportedPoints [i].state = FT62XX_TOUCH_NONE;
+  }
+  maxFrameAge = FT6206_FRAME_AGE_UNLIMITED;
 
   // Initialize other variables.
   rotation = 0;
+  touchWidth = 0;
+  touchHeight = 0;
+  mirrorX = false;
+  mirrorY = false;
+  offsetX = 0;
+  offsetY = 0;
+  calibrated = false;
+
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    rawX [i] = 0;
+    rawY [i] = 0;
+  }
+
+  updateTransform();
   inited = false;
+  initState = FT6206_INIT_IDLE;
+  initDeadline = 0;
+  initTimeout = 0;
+  chipID = 0;
+  vendorID = 0;
+  idMismatch = FT6206_ID_OK;
 }
 
 //============================================================================================//
 /**
-  @brief  Setups the I2C interface and hardware, identifies if chip is found.
+  @brief  Setups the I2C interface and hardware, identifies if chip is found. This blocks
+  until the initialization is complete (about 330 ms with a reset pin). Use beginAsync()
+  and poll() to initialize without blocking.
 
   @returns True if an FT6206 is found, false on any failure.
 */
@@ -55,64 +186,268 @@ bool CSE_FT6206:: begin () {
   if (inited) {
     return true;
   }
-  
+
+  beginAsync();
+
+  while (true) {
+    uint8_t state = poll();
+
+    if (state == FT6206_INIT_READY) {
+      return true;
+    }
+
+    if (state == FT6206_INIT_FAILED) {
+      return false;
+    }
+
+    delay (1);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the initialization without blocking. The reset sequence, the post-reset
+  wait, the chip identification and the threshold setup are then run by calling poll()
+  until it returns FT6206_INIT_READY or FT6206_INIT_FAILED. Each poll() call returns
+  immediately if the next step is not due yet.
+
+  @returns True if the initialization was started or is already complete.
+*/
+bool CSE_FT6206:: beginAsync (void) {
+  if (inited) {
+    initState = FT6206_INIT_READY;
+    return true;
+  }
+
   // Initialize I2C if not already done.
-  wireInstance->begin();
+  transport->begin();
+  configValid = false;  // The reset restores the register defaults
+
+  if (pinInterrupt != -1) {
+    pinMode (pinInterrupt, INPUT_PULLUP);
+  }
 
   if (pinReset >= 0) {
     pinMode (pinReset, OUTPUT);
     digitalWrite (pinReset, HIGH);
-    delay (10);
-    digitalWrite (pinReset, LOW);
-    delay (10);
-    digitalWrite (pinReset, HIGH);
-    delay (10);
+    setInitState (FT6206_INIT_RESET_HIGH, FT6206_RESET_PULSE_MS);
+  }
+  else {
+    setInitState (FT6206_INIT_WAIT_BOOT, FT6206_BOOT_DELAY_MS);
   }
 
-  delay (300);  // FT6206 needs a delay after reset
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Runs the next step of the initialization if it is due. Never blocks.
 
-  if (pinInterrupt != -1) {
-    pinMode (pinInterrupt, INPUT_PULLUP);
+  @returns The current initialization state (FT6206_INIT_*).
+*/
+uint8_t CSE_FT6206:: poll (void) {
+  if ((int32_t) (millis() - initDeadline) < 0) {
+    return initState; // The current step is not due yet
   }
 
-  #ifdef CSE_FT6206_DEBUG
-    DEBUG_SERIAL.print ("Vendor ID: 0x");
-    DEBUG_SERIAL.println (readRegister8 (FT62XX_REG_FOCALTECH_ID), HEX);
-    DEBUG_SERIAL.print ("Chip ID: 0x");
-    DEBUG_SERIAL.println (readRegister8 (FT62XX_REG_CIPHER), HEX);
-    DEBUG_SERIAL.print ("Firmware Version: ");
-    DEBUG_SERIAL.println (readRegister8 (FT62XX_REG_FIRMID));
-    DEBUG_SERIAL.print ("Sample Rate Hz: ");
-    DEBUG_SERIAL.println (readRegister8 (FT62XX_REG_PERIODACTIVE));
-    DEBUG_SERIAL.print ("Threshold: ");
-    DEBUG_SERIAL.println (readRegister8 (FT62XX_REG_TH_GROUP));
-
-    // dump all registers
-    for (int16_t i = 0; i < 0x10; i++) {
-      DEBUG_SERIAL.print ("I2C $");
-      DEBUG_SERIAL.print (i, HEX);
-      DEBUG_SERIAL.print (" = 0x");
-      DEBUG_SERIAL.println (readRegister8 (i), HEX);
-    }
+  switch (initState) {
+    case FT6206_INIT_RESET_HIGH:
+      digitalWrite (pinReset, LOW);
+      setInitState (FT6206_INIT_RESET_LOW, FT6206_RESET_PULSE_MS);
+      break;
 
-    if (readRegister8 (FT62XX_REG_CIPHER) != FT62XX_VALUE_CHIP_ID) {
-      DEBUG_SERIAL.print ("Returned Chip ID 0x");
-      DEBUG_SERIAL.print (readRegister8 (FT62XX_REG_CIPHER), HEX);
-      DEBUG_SERIAL.print (" is different from expected 0x");
-      DEBUG_SERIAL.println (FT62XX_VALUE_CHIP_ID, HEX);
-      // return false;
-    }
+    case FT6206_INIT_RESET_LOW:
+      digitalWrite (pinReset, HIGH);
+      setInitState (FT6206_INIT_RESET_RELEASE, FT6206_RESET_PULSE_MS);
+      break;
 
-    if (readRegister8 (FT62XX_REG_FOCALTECH_ID) != FT62XX_VALUE_PANEL_ID) {
-      DEBUG_SERIAL.print ("Returned Vendor ID 0x");
-      DEBUG_SERIAL.print (readRegister8 (FT62XX_REG_FOCALTECH_ID), HEX);
-      DEBUG_SERIAL.print (" is different from expected 0x");
-      DEBUG_SERIAL.println (FT62XX_VALUE_PANEL_ID, HEX);
-      // return false;
-    }
-  #endif
+    case FT6206_INIT_RESET_RELEASE:
+      setInitState (FT6206_INIT_WAIT_BOOT, FT6206_BOOT_DELAY_MS); // FT6206 needs a delay after reset
+      break;
+
+    case FT6206_INIT_WAIT_BOOT:
+      initTimeout = millis() + FT6206_IDENTIFY_TIMEOUT_MS;
+      setInitState (FT6206_INIT_IDENTIFY, 0);
+      break;
+
+    case FT6206_INIT_IDENTIFY:
+      // The controller may still be booting; retry until the timeout if it does not ACK.
+      if (!probe()) {
+        if ((int32_t) (millis() - initTimeout) >= 0) {
+          setInitState (FT6206_INIT_FAILED, 0);
+        }
+        else {
+          setInitState (FT6206_INIT_IDENTIFY, FT6206_IDENTIFY_RETRY_MS);
+        }
+        break;
+      }
+
+      chipID = readRegister8 (FT62XX_REG_CIPHER);
+      vendorID = readRegister8 (FT62XX_REG_FOCALTECH_ID);
+
+      // A controller that ACKs before its firmware runs reads blank IDs, so these are
+      // retried too. A failed read also returns 0.
+      if ((chipID == 0x00) || (chipID == 0xFF) || (vendorID == 0x00) || (vendorID == 0xFF)) {
+        if ((int32_t) (millis() - initTimeout) >= 0) {
+          idMismatch = FT6206_ID_CHIP_MISMATCH;
+          setInitState (FT6206_INIT_FAILED, 0);
+        }
+        else {
+          setInitState (FT6206_INIT_IDENTIFY, FT6206_IDENTIFY_RETRY_MS);
+        }
+        break;
+      }
+
+      // The panel ID depends on the maker of the module, so only an unknown chip fails.
+      idMismatch = FT6206_ID_OK;
+
+      if ((chipID != FT62XX_VALUE_CHIP_ID) && (chipID != FT62XX_VALUE_CHIP_ID_FT6236) && (chipID != FT62XX_VALUE_CHIP_ID_FT6236U)) {
+        idMismatch |= FT6206_ID_CHIP_MISMATCH;
+      }
+
+      if (vendorID != FT62XX_VALUE_PANEL_ID) {
+        idMismatch |= FT6206_ID_PANEL_MISMATCH;
+      }
+
+      setInitState ((idMismatch & FT6206_ID_CHIP_MISMATCH) ? FT6206_INIT_FAILED : FT6206_INIT_CONFIGURE, 0);
+      break;
+
+    case FT6206_INIT_CONFIGURE:
+      if (setThreshold()) {
+        inited = true;
+        setInitState (FT6206_INIT_READY, 0);
+      }
+      else {
+        setInitState (FT6206_INIT_FAILED, 0);
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return initState;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the current initialization state (FT6206_INIT_*).
+*/
+uint8_t CSE_FT6206:: getInitState (void) {
+  return initState;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the chip ID read from FT62XX_REG_CIPHER during the initialization.
+*/
+uint8_t CSE_FT6206:: getChipID (void) {
+  return chipID;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the panel vendor ID read from FT62XX_REG_FOCALTECH_ID during the
+  initialization.
+*/
+uint8_t CSE_FT6206:: getVendorID (void) {
+  return vendorID;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns how the IDs read during the initialization differ from the known ones.
+  The initialization fails on FT6206_ID_CHIP_MISMATCH, which is also set if the IDs still
+  read blank at the timeout. FT6206_ID_PANEL_MISMATCH only reports a panel ID other than
+  the default, which modules of other makers can have.
+
+  @returns FT6206_ID_OK, or FT6206_ID_* flags.
+*/
+uint8_t CSE_FT6206:: getIDMismatch (void) {
+  return idMismatch;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the I2C address of the controller. The FT6206 uses 0x38, but some modules
+  and related FocalTech controllers use other addresses.
+
+  @param  address The 7-bit I2C address.
+*/
+void CSE_FT6206:: setAddress (uint8_t address) {
+  i2cAddress = address;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the I2C address of the controller.
+*/
+uint8_t CSE_FT6206:: getAddress (void) {
+  return i2cAddress;
+}
+
+//============================================================================================//
+/**
+  @brief  Places the controller behind a multiplexer channel. The channel is selected
+  before every transfer, but the multiplexer is only written when another channel was
+  selected last. Several panels can share one multiplexer.
+
+  @param  mux The multiplexer, or NULL if the controller is directly on the bus.
+  @param  channel The multiplexer channel of the controller.
+*/
+void CSE_FT6206:: attachMux (CSE_FT6206_Mux *mux, uint8_t channel) {
+  this->mux = mux;
+  muxChannel = channel;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the multiplexer of the controller, or NULL if there is none.
+*/
+CSE_FT6206_Mux *CSE_FT6206:: getMux (void) {
+  return mux;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the multiplexer channel of the controller.
+*/
+uint8_t CSE_FT6206:: getMuxChannel (void) {
+  return muxChannel;
+}
+
+//============================================================================================//
+/**
+  @brief  Selects the multiplexer channel of the controller, if it has one.
+
+  @returns True if the controller can be accessed.
+*/
+bool CSE_FT6206:: selectChannel (void) {
+  return (mux == NULL) || mux->select (muxChannel);
+}
+
+//============================================================================================//
+/**
+  @brief  Checks whether the controller acknowledges its address.
+*/
+bool CSE_FT6206:: probe (void) {
+  if (!selectChannel()) {
+    return false;
+  }
+
+  return (transport->probe (i2cAddress) == FT6206_I2C_OK);
+}
+
+//============================================================================================//
+/**
+  @brief  Moves the initialization to a new state and sets when the state is due.
 
-  return setThreshold();
+  @param  state The new state.
+  @param  delayMs The time from now after which poll() runs the state.
+*/
+void CSE_FT6206:: setInitState (uint8_t state, uint32_t delayMs) {
+  initState = state;
+  initDeadline = millis() + delayMs;
 }
 
 //============================================================================================//
@@ -138,10 +473,213 @@ uint8_t CSE_FT6206:: setRotation (uint8_t r) {
       height = defWidth;
       break;
   }
+
+  updateTransform();
   
   return rotation;
 }
 
+//============================================================================================//
+/**
+ * @brief Sets the native resolution of the touch controller when it differs from the
+ * display. The points are scaled to the display size given in the constructor.
+ * 
+ * @param w Touch controller width. 0 means same as the display.
+ * @param h Touch controller height. 0 means same as the display.
+ */
+void CSE_FT6206:: setTouchResolution (uint16_t w, uint16_t h) {
+  touchWidth = w;
+  touchHeight = h;
+  updateTransform();
+}
+
+//============================================================================================//
+/**
+ * @brief Mirrors the touch coordinates before rotation. Use this for panels mounted
+ * flipped relative to the display.
+ * 
+ * @param x Mirror the X axis.
+ * @param y Mirror the Y axis.
+ */
+void CSE_FT6206:: setMirror (bool x, bool y) {
+  mirrorX = x;
+  mirrorY = y;
+  updateTransform();
+}
+
+//============================================================================================//
+/**
+ * @brief Adds an offset to the touch coordinates after rotation.
+ * 
+ * @param x Offset along X in pixels.
+ * @param y Offset along Y in pixels.
+ */
+void CSE_FT6206:: setOffset (int16_t x, int16_t y) {
+  offsetX = x;
+  offsetY = y;
+  updateTransform();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the affine transform that maps the controller coordinates to the display.
+ * 
+ * @return `CSE_FT6206_Affine` The current transform.
+ */
+CSE_FT6206_Affine CSE_FT6206:: getTransform (void) {
+  return transform;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets a calibration solved by `CSE_FT6206_Calibration`. It replaces the touch
+ * resolution scaling and mirroring. Rotation and offset are still applied after it.
+ * 
+ * @param coefficients Transform from the controller coordinates to the unrotated display.
+ */
+void CSE_FT6206:: setCalibration (const CSE_FT6206_Affine &coefficients) {
+  calibration = coefficients;
+  calibrated = true;
+  updateTransform();
+}
+
+//============================================================================================//
+/**
+ * @brief Removes the calibration and goes back to the touch resolution scaling and
+ * mirroring.
+ */
+void CSE_FT6206:: clearCalibration (void) {
+  calibrated = false;
+  updateTransform();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns true if a calibration is set.
+ */
+bool CSE_FT6206:: isCalibrated (void) {
+  return calibrated;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns a touch point of the current frame in the controller coordinates, before
+ * calibration, scaling, mirroring, rotation and offset. Use this to collect the raw points
+ * for calibration.
+ * 
+ * @param n The touch point number (0 or 1).
+ * @return `CSE_TouchPoint` The raw point.
+ */
+CSE_TouchPoint CSE_FT6206:: getRawPoint (uint8_t n) {
+  if (n >= FT6206_MAX_TOUCH_POINTS) {
+    return CSE_TouchPoint();
+  }
+
+  CSE_TouchPoint point = getPoint (n);
+  point.x = rawX [n];
+  point.y = rawY [n];
+
+  return point;
+}
+
+//============================================================================================//
+/**
+ * @brief Recomputes the affine transform from the touch resolution, mirroring, rotation
+ * and offset. This is only called when one of them changes, so that decoding a point
+ * costs a single multiply-add pass.
+ */
+void CSE_FT6206:: updateTransform (void) {
+  CSE_FT6206_Affine m;
+
+  if (calibrated) {
+    // The calibration already maps to the unrotated display, including any mirroring.
+    m = calibration;
+  }
+  else {
+    // Scale the controller resolution to the display.
+    m.a = (touchWidth > 0) ? ((int32_t (defWidth) << FT6206_AFFINE_SHIFT) / touchWidth) : FT6206_AFFINE_ONE;
+    m.b = 0;
+    m.c = 0;
+    m.d = 0;
+    m.e = (touchHeight > 0) ? ((int32_t (defHeight) << FT6206_AFFINE_SHIFT) / touchHeight) : FT6206_AFFINE_ONE;
+    m.f = 0;
+
+    // Mirror in the unrotated display space.
+    CSE_FT6206_Affine mirror = { FT6206_AFFINE_ONE, 0, 0, 0, FT6206_AFFINE_ONE, 0 };
+
+    if (mirrorX) {
+      mirror.a = -FT6206_AFFINE_ONE;
+      mirror.c = int32_t (defWidth) << FT6206_AFFINE_SHIFT;
+    }
+
+    if (mirrorY) {
+      mirror.e = -FT6206_AFFINE_ONE;
+      mirror.f = int32_t (defHeight) << FT6206_AFFINE_SHIFT;
+    }
+
+    m = composeAffine (mirror, m);
+  }
+
+  // Rotate. The width and height here are the ones after rotation.
+  CSE_FT6206_Affine rotate = { FT6206_AFFINE_ONE, 0, 0, 0, FT6206_AFFINE_ONE, 0 };
+  int32_t w = int32_t (width) << FT6206_AFFINE_SHIFT;
+  int32_t h = int32_t (height) << FT6206_AFFINE_SHIFT;
+
+  switch (rotation) {
+    case 1: // x = y, y = height - x
+      rotate.a = 0; rotate.b = FT6206_AFFINE_ONE; rotate.c = 0;
+      rotate.d = -FT6206_AFFINE_ONE; rotate.e = 0; rotate.f = h;
+      break;
+    case 2: // x = width - x, y = height - y
+      rotate.a = -FT6206_AFFINE_ONE; rotate.b = 0; rotate.c = w;
+      rotate.d = 0; rotate.e = -FT6206_AFFINE_ONE; rotate.f = h;
+      break;
+    case 3: // x = width - y, y = x
+      rotate.a = 0; rotate.b = -FT6206_AFFINE_ONE; rotate.c = w;
+      rotate.d = FT6206_AFFINE_ONE; rotate.e = 0; rotate.f = 0;
+      break;
+  }
+
+  m = composeAffine (rotate, m);
+
+  // Offset in the rotated display space.
+  m.c += int32_t (offsetX) << FT6206_AFFINE_SHIFT;
+  m.f += int32_t (offsetY) << FT6206_AFFINE_SHIFT;
+
+  transform = m;
+  lastRawLength = 0;  // The next frame has to be mapped with the new transform
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the transform that applies the inner transform first, then the outer.
+ */
+CSE_FT6206_Affine CSE_FT6206:: composeAffine (const CSE_FT6206_Affine &outer, const CSE_FT6206_Affine &inner) {
+  CSE_FT6206_Affine r;
+
+  r.a = int32_t ((int64_t (outer.a) * inner.a + int64_t (outer.b) * inner.d) >> FT6206_AFFINE_SHIFT);
+  r.b = int32_t ((int64_t (outer.a) * inner.b + int64_t (outer.b) * inner.e) >> FT6206_AFFINE_SHIFT);
+  r.c = int32_t (((int64_t (outer.a) * inner.c + int64_t (outer.b) * inner.f) >> FT6206_AFFINE_SHIFT) + outer.c);
+  r.d = int32_t ((int64_t (outer.d) * inner.a + int64_t (outer.e) * inner.d) >> FT6206_AFFINE_SHIFT);
+  r.e = int32_t ((int64_t (outer.d) * inner.b + int64_t (outer.e) * inner.e) >> FT6206_AFFINE_SHIFT);
+  r.f = int32_t (((int64_t (outer.d) * inner.c + int64_t (outer.e) * inner.f) >> FT6206_AFFINE_SHIFT) + outer.f);
+
+  return r;
+}
+
+//============================================================================================//
+/**
+ * @brief Maps a point from the controller coordinates to the display coordinates with the
+ * precomputed transform. The result is rounded to the nearest pixel.
+ */
+void CSE_FT6206:: applyTransform (CSE_TouchPoint &point) {
+  int32_t x = point.x;
+  int32_t y = point.y;
+
+  point.x = int16_t ((transform.a * x + transform.b * y + transform.c + FT6206_AFFINE_HALF) >> FT6206_AFFINE_SHIFT);
+  point.y = int16_t ((transform.d * x + transform.e * y + transform.f + FT6206_AFFINE_HALF) >> FT6206_AFFINE_SHIFT);
+}
+
 //============================================================================================//
 /**
  * @brief Get the current rotation setting.
@@ -179,27 +717,23 @@ uint16_t CSE_FT6206:: getHeight() {
   @param  threshold Optional threshhold-for-touch value, default is
   FT6206_DEFAULT_THRESSHOLD but you can try changing it if your screen is
   too/not sensitive.
+
+  @returns True if the value was written and read back, false on any failure.
 */
 bool CSE_FT6206:: setThreshold (uint8_t threshold) {
   // Change threshold to be higher/lower.
-  writeRegister8 (FT62XX_REG_TH_GROUP, threshold);
-  return true;
-} 
+  return writeConfig (FT62XX_REG_TH_GROUP, &threshold, 1);
+}
 
 //============================================================================================//
 /**
-  @brief Returns the number of touches detected.
+  @brief Returns the number of touches detected in the current frame.
 
   @returns Number of touches detected. Can be 0, 1 or 2.
 */
 uint8_t CSE_FT6206:: getTouches (void) {
-  // Read the number of active touches.
-  uint8_t n = readRegister8 (FT62XX_REG_TD_STATUS);
-
-  if (n > 2) {
-    n = 0;
-  }
-  return n;
+  refreshFrame();
+  return touches;
 }
 
 //============================================================================================//
@@ -215,8 +749,7 @@ bool CSE_FT6206:: isTouched (uint8_t id) {
     return false;
   }
   
-  // fastReadData (id);
-  readData();
+  refreshFrame();
   
   // Check if the point is touched.
   // A contact means the screen is being actively touched.
@@ -233,8 +766,7 @@ bool CSE_FT6206:: isTouched (uint8_t id) {
  * @returns  True if touched, false if not.
  */
 bool CSE_FT6206:: isTouched (void) {
-  // return (getTouches() > 0);
-  return (readRegister8 (FT62XX_REG_TD_STATUS) > 0);
+  return (getTouches() > 0);
 }
 
 //============================================================================================//
@@ -251,8 +783,7 @@ CSE_TouchPoint CSE_FT6206:: getPoint (uint8_t n) {
     return CSE_TouchPoint(); // Return empty point
   }
 
-  // fastReadData (n);
-  readData();
+  refreshFrame();
   return touchPoints [n];
 }
 
@@ -260,11 +791,12 @@ CSE_TouchPoint CSE_FT6206:: getPoint (uint8_t n) {
 /**
   @brief  Reads the report rate or scan rate in the active mode. The default value
   is usually 6 Hz and max is 14 hz. You can modify this with setMonitorScanRate().
+  The value is served from the register shadow.
 
-  @returns True if the data was read successfully, false on any failure.
+  @returns The active scan rate.
 */
 uint8_t CSE_FT6206:: getActiveScanRate() {
-  return readRegister8 (FT62XX_REG_PERIODACTIVE);
+  return readConfig (FT62XX_REG_PERIODACTIVE);
 }
 
 //============================================================================================//
@@ -274,10 +806,12 @@ uint8_t CSE_FT6206:: getActiveScanRate() {
 
   But why is monitor scan rate higher than active scan rate? I don't know.
 
-  @returns True if the data was read successfully, false on any failure.
+  The value is served from the register shadow.
+
+  @returns The monitor scan rate.
 */
 uint8_t CSE_FT6206:: getMonitorScanRate() {
-  return readRegister8 (FT62XX_REG_PERIODMONITOR);
+  return readConfig (FT62XX_REG_PERIODMONITOR);
 }
 
 //============================================================================================//
@@ -286,11 +820,10 @@ uint8_t CSE_FT6206:: getMonitorScanRate() {
 
   @param  rate The rate to set the active scan rate to. The default is 6 Hz.
 
-  @returns True if the data was read successfully, false on any failure.
+  @returns True if the value was written and read back, false on any failure.
 */
 bool CSE_FT6206:: setMonitorScanRate (uint8_t rate) {
-  writeRegister8 (FT62XX_REG_PERIODMONITOR, rate);
-  return true;
+  return writeConfig (FT62XX_REG_PERIODMONITOR, &rate, 1);
 }
 
 //============================================================================================//
@@ -299,21 +832,21 @@ bool CSE_FT6206:: setMonitorScanRate (uint8_t rate) {
 
   @param  rate The rate to set the monitor scan rate to. The default is 6 Hz.
 
-  @returns True if the data was read successfully, false on any failure.
+  @returns True if the value was written and read back, false on any failure.
 */
 bool CSE_FT6206:: setActiveScanRate (uint8_t rate) {
-  writeRegister8 (FT62XX_REG_PERIODACTIVE, rate);
-  return true;
+  return writeConfig (FT62XX_REG_PERIODACTIVE, &rate, 1);
 }
 
 //============================================================================================//
 /**
   @brief  Reads the interrupt output mode. The default value is 0x1 (Trigger mode).
+  The value is served from the register shadow.
 
   @returns The interrupt mode; either 1 (trigger mode) or 0 (polling mode).
 */
 uint8_t CSE_FT6206:: getInterruptMode() {
-  return readRegister8 (FT62XX_REG_G_MODE);
+  return readConfig (FT62XX_REG_G_MODE);
 }
 
 //============================================================================================//
@@ -322,294 +855,1744 @@ uint8_t CSE_FT6206:: getInterruptMode() {
 
   @param  mode The interrupt mode; either 1 (trigger mode) or 0 (polling mode).
 
-  @returns True if the data was read successfully, false on any failure.
+  @returns True if the value was written and read back, false on any failure.
 */
 bool CSE_FT6206:: setInterruptMode (uint8_t mode) {
   if (mode > 1) {
     mode = 1;
   }
-  writeRegister8 (FT62XX_REG_G_MODE, mode);
-  return true;
+  return writeConfig (FT62XX_REG_G_MODE, &mode, 1);
 }
 
 //============================================================================================//
 /**
-  @brief  Reads the current gesture ID.
-
-  @returns The current gesture ID.
+  @brief  Returns true if the controller switches to the monitor mode on its own after
+  the monitor timeout without a touch (CTRL register). Served from the register shadow.
 */
-uint8_t CSE_FT6206:: getGestureID() {
-  return readRegister8 (FT62XX_REG_GEST_ID);
+bool CSE_FT6206:: getAutoMonitor (void) {
+  return (readConfig (FT62XX_REG_CTRL) != 0);
 }
 
 //============================================================================================//
 /**
-  @brief  Reads the current gesture ID and returns a string with the gesture name.
+  @brief  Enables or disables the automatic switch to the monitor mode. When enabled, the
+  controller enters the monitor mode after the monitor timeout without a touch, and returns
+  to the active mode on the next touch by itself.
 
-  @returns The current gesture name.
+  @param  enable True to switch automatically, false to stay in the active mode.
+
+  @returns True if the value was written and read back, false on any failure.
 */
-String CSE_FT6206:: getGestureName() {
-  uint8_t gestureID = getGestureID();
-  
-  switch (gestureID) {
-    case FT62XX_GESTURE_MOVE_UP:
-      return String ("Move Up");
-    case FT62XX_GESTURE_MOVE_RIGHT:
-      return String ("Move Right");
-    case FT62XX_GESTURE_MOVE_DOWN:
-      return String ("Move Down");
-    case FT62XX_GESTURE_MOVE_LEFT:
-      return String ("Move Left");
-    case FT62XX_GESTURE_ZOOM_IN:
-      return String ("Zoom In");
-    case FT62XX_GESTURE_ZOOM_OUT:
-      return String ("Zoom Out");
-    default:
-      return String ("None");
-  } 
+bool CSE_FT6206:: setAutoMonitor (bool enable) {
+  uint8_t value = enable ? 1 : 0;
+  return writeConfig (FT62XX_REG_CTRL, &value, 1);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the time without a touch before the controller enters the monitor mode
+  (TIMEENTERMONITOR register), in seconds. Served from the register shadow.
+*/
+uint8_t CSE_FT6206:: getMonitorTimeout (void) {
+  return readConfig (FT62XX_REG_TIMEENTERMONITOR);
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the time without a touch before the controller enters the monitor mode. Only
+  used when the automatic switch is enabled with setAutoMonitor().
+
+  @param  seconds The timeout in seconds.
+
+  @returns True if the value was written and read back, false on any failure.
+*/
+bool CSE_FT6206:: setMonitorTimeout (uint8_t seconds) {
+  return writeConfig (FT62XX_REG_TIMEENTERMONITOR, &seconds, 1);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the power mode (PWR_MODE register), one of FT62XX_PWR_*. Always read from
+  the controller, since it changes the mode by itself when the automatic monitor mode is
+  enabled.
+
+  @returns The power mode, or 0 if the read failed.
+*/
+uint8_t CSE_FT6206:: getPowerMode (void) {
+  return readRegister8 (FT62XX_REG_PWR_MODE);
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the power mode of the controller.
+
+  @param  mode FT62XX_PWR_ACTIVE or FT62XX_PWR_MONITOR. FT62XX_PWR_HIBERNATE is the same
+  as calling hibernate().
+
+  @returns True if the value was written and read back, false on any failure.
+*/
+bool CSE_FT6206:: setPowerMode (uint8_t mode) {
+  if (mode == FT62XX_PWR_HIBERNATE) {
+    return hibernate();
+  }
+
+  return writeConfig (FT62XX_REG_PWR_MODE, &mode, 1);
+}
+
+//============================================================================================//
+/**
+  @brief  Puts the controller into the hibernate mode, where it draws the least current and
+  does not detect touches. It stops responding on the bus, so the write is not read back.
+  The panel must be initialized again after wake(), and the configuration registers return
+  to their defaults.
+
+  @returns True if the controller acknowledged the write.
+*/
+bool CSE_FT6206:: hibernate (void) {
+  uint8_t mode = FT62XX_PWR_HIBERNATE;
+
+  if (writeRegisters (FT62XX_REG_PWR_MODE, &mode, 1) != 1) {
+    return false;
+  }
+
+  inited = false;
+  initState = FT6206_INIT_IDLE;
+  configValid = false;
+  lastRawLength = 0;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Wakes the controller from the hibernate mode by resetting it, and starts the
+  initialization like beginAsync(). Call poll() until it returns FT6206_INIT_READY, then
+  apply the configuration again. Needs the reset pin.
+
+  @returns True if the reset was started, false if there is no reset pin.
+*/
+bool CSE_FT6206:: wake (void) {
+  if (pinReset < 0) {
+    return false;
+  }
+
+  inited = false;
+  return beginAsync();
+}
+
+//============================================================================================//
+/**
+  @brief  Reads the configuration registers (0x80-0x96) and the interrupt mode register
+  (0xA4) into the shadow, with one burst read each. The configuration getters are served from the
+  shadow afterwards, and it is kept up to date by the setters. It is read automatically the
+  first time it is needed and after a reset.
+
+  @returns True if all the registers were read.
+*/
+bool CSE_FT6206:: refreshConfig (void) {
+  configValid = (readRegisters (FT62XX_CONFIG_START, configShadow, FT62XX_CONFIG_LENGTH) == FT62XX_CONFIG_LENGTH) &&
+    (readRegisters (FT62XX_MODE_START, &configShadow [FT62XX_CONFIG_LENGTH], FT62XX_MODE_LENGTH) == FT62XX_MODE_LENGTH);
+
+  return configValid;
+}
+
+//============================================================================================//
+/**
+  @brief  Copies the configuration from the register shadow into a profile.
+
+  @param  profile The profile to copy the configuration to.
+
+  @returns True if the shadow is valid.
+*/
+bool CSE_FT6206:: getProfile (CSE_FT6206_Profile &profile) {
+  if ((!configValid) && (!refreshConfig())) {
+    return false;
+  }
+
+  profile.threshold = readConfig (FT62XX_REG_TH_GROUP);
+  profile.filterCoefficient = readConfig (FT62XX_REG_TH_DIFF);
+  profile.ctrl = readConfig (FT62XX_REG_CTRL);
+  profile.timeEnterMonitor = readConfig (FT62XX_REG_TIMEENTERMONITOR);
+  profile.periodActive = readConfig (FT62XX_REG_PERIODACTIVE);
+  profile.periodMonitor = readConfig (FT62XX_REG_PERIODMONITOR);
+  profile.radianValue = readConfig (FT62XX_REG_RADIAN_VALUE);
+  profile.offsetLeftRight = readConfig (FT62XX_REG_OFFSET_LEFT_RIGHT);
+  profile.offsetUpDown = readConfig (FT62XX_REG_OFFSET_UP_DOWN);
+  profile.distanceLeftRight = readConfig (FT62XX_REG_DISTANCE_LEFT_RIGHT);
+  profile.distanceUpDown = readConfig (FT62XX_REG_DISTANCE_UP_DOWN);
+  profile.distanceZoom = readConfig (FT62XX_REG_DISTANCE_ZOOM);
+  profile.interruptMode = readConfig (FT62XX_REG_G_MODE);
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes a configuration profile. Only the registers that differ from the shadow
+  are written. The writable registers form four blocks (0x80, 0x85-0x89, 0x91-0x96 and
+  0xA4), and each block is written with one auto-increment write that spans its changed
+  registers, followed by one burst read to verify it.
+
+  @param  profile The profile to write.
+
+  @returns True if all the changed registers were written and read back, false on any
+  failure.
+*/
+bool CSE_FT6206:: applyProfile (const CSE_FT6206_Profile &profile) {
+  if ((!configValid) && (!refreshConfig())) {
+    return false;
+  }
+
+  // Build the wanted register values in shadow order.
+  uint8_t wanted [FT62XX_CONFIG_LENGTH + FT62XX_MODE_LENGTH];
+  memcpy (wanted, configShadow, sizeof (wanted));
+  wanted [shadowIndex (FT62XX_REG_TH_GROUP)] = profile.threshold;
+  wanted [shadowIndex (FT62XX_REG_TH_DIFF)] = profile.filterCoefficient;
+  wanted [shadowIndex (FT62XX_REG_CTRL)] = profile.ctrl;
+  wanted [shadowIndex (FT62XX_REG_TIMEENTERMONITOR)] = profile.timeEnterMonitor;
+  wanted [shadowIndex (FT62XX_REG_PERIODACTIVE)] = profile.periodActive;
+  wanted [shadowIndex (FT62XX_REG_PERIODMONITOR)] = profile.periodMonitor;
+  wanted [shadowIndex (FT62XX_REG_RADIAN_VALUE)] = profile.radianValue;
+  wanted [shadowIndex (FT62XX_REG_OFFSET_LEFT_RIGHT)] = profile.offsetLeftRight;
+  wanted [shadowIndex (FT62XX_REG_OFFSET_UP_DOWN)] = profile.offsetUpDown;
+  wanted [shadowIndex (FT62XX_REG_DISTANCE_LEFT_RIGHT)] = profile.distanceLeftRight;
+  wanted [shadowIndex (FT62XX_REG_DISTANCE_UP_DOWN)] = profile.distanceUpDown;
+  wanted [shadowIndex (FT62XX_REG_DISTANCE_ZOOM)] = profile.distanceZoom;
+  wanted [shadowIndex (FT62XX_REG_G_MODE)] = (profile.interruptMode > 1) ? 1 : profile.interruptMode;
+
+  // The writable blocks. Reserved registers in between are never written.
+  static const uint8_t blocks [][2] = {
+    { FT62XX_REG_TH_GROUP, FT62XX_REG_TH_GROUP },
+    { FT62XX_REG_TH_DIFF, FT62XX_REG_PERIODMONITOR },
+    { FT62XX_REG_RADIAN_VALUE, FT62XX_REG_DISTANCE_ZOOM },
+    { FT62XX_REG_G_MODE, FT62XX_REG_G_MODE }
+  };
+
+  bool success = true;
+
+  for (uint8_t b = 0; b < (sizeof (blocks) / sizeof (blocks [0])); b++) {
+    int16_t first = -1, last = -1;
+
+    for (uint8_t reg = blocks [b][0]; reg <= blocks [b][1]; reg++) {
+      int8_t i = shadowIndex (reg);
+
+      if (wanted [i] != configShadow [i]) {
+        first = (first < 0) ? reg : first;
+        last = reg;
+      }
+    }
+
+    if (first >= 0) {
+      success &= writeConfig (uint8_t (first), &wanted [shadowIndex (uint8_t (first))], uint8_t (last - first + 1));
+    }
+  }
+
+  return success;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns a register from the shadow, reading the shadow first if it is not valid.
+  If the shadow cannot be read, the register is read directly, so that a stale or
+  uninitialized shadow is never returned.
+
+  @returns The register value, or 0 if it could not be read. Use getLastError() to tell a
+  failure from a register that holds 0.
+*/
+uint8_t CSE_FT6206:: readConfig (uint8_t reg) {
+  int8_t i = shadowIndex (reg);
+
+  if ((i < 0) || ((!configValid) && (!refreshConfig()))) {
+    return readRegister8 (reg);
+  }
+
+  return configShadow [i];
+}
+
+//============================================================================================//
+/**
+  @brief  Writes consecutive shadowed registers with one auto-increment write, reads them
+  back with one burst read, and updates the shadow with the values read.
+
+  @returns True if the values read back are the ones written.
+*/
+bool CSE_FT6206:: writeConfig (uint8_t reg, const uint8_t *values, uint8_t length) {
+  uint8_t readback [FT62XX_CONFIG_LENGTH];
+  int8_t i = shadowIndex (reg);
+
+  if ((length == 0) || (length > FT62XX_CONFIG_LENGTH)) {
+    return false;
+  }
+
+  if (writeRegisters (reg, values, length) != length) {
+    return false;
+  }
+
+  if (readRegisters (reg, readback, length) != length) {
+    return false;
+  }
+
+  if (i >= 0) {
+    memcpy (&configShadow [i], readback, length);
+  }
+
+  return (memcmp (readback, values, length) == 0);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the index of a register in the shadow, or -1 if it is not shadowed.
+*/
+int8_t CSE_FT6206:: shadowIndex (uint8_t reg) {
+  if ((reg >= FT62XX_CONFIG_START) && (reg < (FT62XX_CONFIG_START + FT62XX_CONFIG_LENGTH))) {
+    return int8_t (reg - FT62XX_CONFIG_START);
+  }
+
+  if ((reg >= FT62XX_MODE_START) && (reg < (FT62XX_MODE_START + FT62XX_MODE_LENGTH))) {
+    return int8_t (FT62XX_CONFIG_LENGTH + (reg - FT62XX_MODE_START));
+  }
+
+  return -1;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the gesture ID of the current frame.
+
+  @returns The current gesture ID.
+*/
+uint8_t CSE_FT6206:: getGestureID() {
+  refreshFrame();
+  return gestureID;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the name of the hardware gesture of the current frame. The name is a
+  constant string and nothing is allocated.
+
+  @returns The current gesture name.
+*/
+const char *CSE_FT6206:: getGestureName() {
+  uint8_t gestureID = getGestureID();
+  
+  switch (gestureID) {
+    case FT62XX_GESTURE_MOVE_UP:
+      return "Move Up";
+    case FT62XX_GESTURE_MOVE_RIGHT:
+      return "Move Right";
+    case FT62XX_GESTURE_MOVE_DOWN:
+      return "Move Down";
+    case FT62XX_GESTURE_MOVE_LEFT:
+      return "Move Left";
+    case FT62XX_GESTURE_ZOOM_IN:
+      return "Zoom In";
+    case FT62XX_GESTURE_ZOOM_OUT:
+      return "Zoom Out";
+    default:
+      return "None";
+  } 
+}
+
+//============================================================================================//
+/**
+  @brief  Reads a new frame from the FT6206 into the snapshot. All accessors serve
+  from this snapshot until the next update, unless a staleness budget is set with
+  setMaxFrameAge().
+
+  @returns True if a frame was read.
+*/
+bool CSE_FT6206:: update (void) {
+  return readData();
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how old the snapshot can get before the accessors (getPoint(), isTouched(),
+  getTouches() and getGestureID()) read a new frame on their own. The default is
+  FT6206_FRAME_AGE_UNLIMITED, where the accessors never touch the bus and the frame is
+  only read by update() or readData(). Setting 0 reads a new frame on every call.
+
+  @param  us The maximum age of the snapshot in microseconds.
+*/
+void CSE_FT6206:: setMaxFrameAge (uint32_t us) {
+  maxFrameAge = us;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the staleness budget of the accessors in microseconds.
+*/
+uint32_t CSE_FT6206:: getMaxFrameAge (void) {
+  return maxFrameAge;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the sequence number of the current frame. It is incremented on every
+  frame read and is 0 if no frame was read yet.
+*/
+uint32_t CSE_FT6206:: getFrameSeq (void) {
+  return frameSeq;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the micros() timestamp of the current frame.
+*/
+uint32_t CSE_FT6206:: getFrameTime (void) {
+  return frameTime;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the age of the current frame in microseconds.
+*/
+uint32_t CSE_FT6206:: getFrameAge (void) {
+  return micros() - frameTime;
+}
+
+//============================================================================================//
+/**
+  @brief  Reads a new frame if the snapshot is older than the staleness budget, or if
+  a budget is set and no frame was read yet.
+*/
+void CSE_FT6206:: refreshFrame (void) {
+  if (maxFrameAge == FT6206_FRAME_AGE_UNLIMITED) {
+    return;
+  }
+
+  if ((frameSeq == 0) || ((micros() - frameTime) > maxFrameAge)) {
+    readData();
+  }
 }
 
 //============================================================================================//
 /**
   @brief  Reads the touch-related data from the FT6206 and saves them to the
   class variables. The reading is done in one go.
+
+  With the FT62XX_READ_ADAPTIVE strategy, only the registers of the points that
+  can be active are read. The length is predicted from the touch count of the previous
+  frame (3 bytes when idle, 9 for one point and 15 for two), so that a lift-up event is
+  still read in the frame where the count drops. If the new touch count is higher than
+  predicted, the missing point registers are read with a second tail read.
+
+  A split-phase read in flight is waited for first.
+
+  @returns True if a frame was read, false if the read failed and the frame was dropped.
+*/
+bool CSE_FT6206:: readData (void) {
+  waitForRead();
+
+  uint8_t i2cdat [FT62XX_FRAME_LENGTH] = {0};  // Holds the first 15 bytes of data from the FT6206
+  uint8_t length = FT62XX_FRAME_LENGTH;
+  uint32_t readTime = micros();
+
+  FT6206_METRIC (metrics.readCalls++);
+
+  // The touch count is public and may have been overwritten, so the prediction is limited
+  // to the frame buffer.
+  if (readStrategy == FT62XX_READ_ADAPTIVE) {
+    length = FT62XX_REG_P1_XH + (((touches > FT6206_MAX_TOUCH_POINTS) ? FT6206_MAX_TOUCH_POINTS : touches) * 6);
+  }
+
+  // Read the status registers and the predicted point registers in one go. A frame that
+  // could not be read completely is dropped, and the snapshot keeps the previous frame.
+  if (readRegisters (FT62XX_REG_DEV_MODE, i2cdat, length) != length) {
+    i2cStats.droppedFrames++;
+    FT6206_METRIC (recordRead (readTime, false, false));
+    return false;
+  }
+
+  if (readStrategy == FT62XX_READ_ADAPTIVE) {
+    uint8_t count = i2cdat [FT62XX_REG_TD_STATUS];
+    uint8_t required = FT62XX_REG_P1_XH + (((count > 2) ? 0 : count) * 6);
+
+    // Prediction was short; fetch the remaining point registers.
+    if (required > length) {
+      if (readRegisters (length, &i2cdat [length], required - length) != (required - length)) {
+        i2cStats.droppedFrames++;
+        FT6206_METRIC (recordRead (readTime, false, false));
+        return false;
+      }
+
+      length = required;
+    }
+  }
+
+  completeRead (readTime, i2cdat, length);
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Records a frame that was read from the bus and takes it into the snapshot.
+
+  @param  readTime micros() at the start of the read.
+  @param  i2cdat The register data starting from FT62XX_REG_DEV_MODE.
+  @param  length The number of bytes read.
+*/
+void CSE_FT6206:: completeRead (uint32_t readTime, const uint8_t *i2cdat, uint8_t length) {
+  if (trace != NULL) {
+    trace->record (readTime, i2cdat, length);
+  }
+
+  frameTime = readTime;
+
+  bool unchanged = acceptFrame (i2cdat, length);
+  FT6206_METRIC (recordRead (readTime, true, unchanged));
+  (void) unchanged; // Only used by the metrics
+}
+
+//============================================================================================//
+/**
+  @brief  Starts reading a frame without waiting for the bus, so that the CPU can do other
+  work, like rendering, during the transfer. Call isReadComplete() until it returns true;
+  the frame is decoded and the processing stages run in that call. The read is the same as
+  readData(), including the adaptive length, the tail read and the retries.
+
+  The transfer runs in the background only if the transport supports it. Otherwise each
+  phase is read blocking here or in isReadComplete(), and the result is the same.
+
+  Other register accesses wait for the read to end. The multiplexer channel is selected
+  blocking before each transfer.
+
+  @returns True if the read was started, false if a read is already in flight.
+*/
+bool CSE_FT6206:: startRead (void) {
+  if (readPhase != FT6206_READ_IDLE) {
+    return false;
+  }
+
+  FT6206_METRIC (metrics.readCalls++);
+  readStartTime = micros();
+  readLength = FT62XX_FRAME_LENGTH;
+
+  if (readStrategy == FT62XX_READ_ADAPTIVE) {
+    readLength = FT62XX_REG_P1_XH + (((touches > FT6206_MAX_TOUCH_POINTS) ? FT6206_MAX_TOUCH_POINTS : touches) * 6);
+  }
+
+  readPhase = FT6206_READ_HEAD;
+  readReg = FT62XX_REG_DEV_MODE;
+  readCount = readLength;
+  readAttempt = 0;
+
+  if (!startTransfer()) {
+    endRead (false);
+  }
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Checks the read started by startRead() without waiting, and moves it to its next
+  step when the transfer has ended. A transfer still pending FT6206_READ_TIMEOUT_US after
+  it was started fails with FT6206_I2C_BUS_ERROR and is retried. The read callback is
+  called from here when the read ends.
+
+  @returns True if no read is in flight.
+*/
+bool CSE_FT6206:: isReadComplete (void) {
+  while (readPhase != FT6206_READ_IDLE) {
+    uint8_t status = readStatus;
+
+    if (status == FT6206_I2C_PENDING) {
+      status = transport->getReadStatus();
+
+      // A transfer that never ends is a bus error, so that the retries apply and the
+      // blocking accesses that wait for it cannot hang.
+      if ((status == FT6206_I2C_PENDING) && ((int32_t) (micros() - readDeadline) >= 0)) {
+        status = FT6206_I2C_BUS_ERROR;
+      }
+
+      if (status == FT6206_I2C_PENDING) {
+        return false;
+      }
+    }
+
+    stepRead (status);
+  }
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the phase of the split-phase read.
+
+  @returns One of FT6206_READ_*.
+*/
+uint8_t CSE_FT6206:: getReadPhase (void) {
+  return readPhase;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the function called when a split-phase read ends.
+
+  @param  callback The function, or NULL to remove it.
+*/
+void CSE_FT6206:: setReadCallback (CSE_FT6206_ReadCallback callback) {
+  readCallback = callback;
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the transfer of the current read phase, retrying while the multiplexer
+  cannot be selected. If the transport cannot read in the background, the phase is read
+  blocking and its result is kept for isReadComplete().
+
+  @returns True if a transfer was made or started, false if the attempts are used up.
+*/
+bool CSE_FT6206:: startTransfer (void) {
+  for (; beginAttempt (readAttempt); readAttempt++) {
+    if (!selectChannel()) {
+      recordError (FT6206_I2C_BUS_ERROR);
+      continue;
+    }
+
+    if (transport->startRead (i2cAddress, readReg, &readBuffer [readReg], readCount)) {
+      readStatus = FT6206_I2C_PENDING;
+      readDeadline = micros() + FT6206_READ_TIMEOUT_US;
+    }
+    else {
+      readStatus = transport->readRegisters (i2cAddress, readReg, &readBuffer [readReg], readCount);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+//============================================================================================//
+/**
+  @brief  Handles the end of the transfer of the current read phase. A failed transfer is
+  retried. After the head phase, the tail phase is started if the touch count is higher
+  than predicted.
+
+  @param  status The result of the transfer, one of FT6206_I2C_*.
+*/
+void CSE_FT6206:: stepRead (uint8_t status) {
+  // The register address and the data, or only the address if it was not acknowledged.
+  FT6206_METRIC (metrics.bytes += ((status == FT6206_I2C_OK) || (status == FT6206_I2C_SHORT_READ)) ? (3 + readCount) : 2);
+
+  if (status != FT6206_I2C_OK) {
+    recordError (status);
+    readAttempt++;
+
+    if (!startTransfer()) {
+      endRead (false);
+    }
+
+    return;
+  }
+
+  i2cStats.transfers++;
+  lastError = FT6206_I2C_OK;
+  FT6206_LOG (FT6206_LOG_READ, readReg, (uint32_t (readCount) << 8) | readBuffer [readReg]);
+
+  if ((readPhase == FT6206_READ_HEAD) && (readStrategy == FT62XX_READ_ADAPTIVE)) {
+    uint8_t count = readBuffer [FT62XX_REG_TD_STATUS];
+    uint8_t required = FT62XX_REG_P1_XH + (((count > 2) ? 0 : count) * 6);
+
+    // Prediction was short; fetch the remaining point registers.
+    if (required > readLength) {
+      readPhase = FT6206_READ_TAIL;
+      readReg = readLength;
+      readCount = required - readLength;
+      readAttempt = 0;
+
+      if (!startTransfer()) {
+        endRead (false);
+      }
+
+      return;
+    }
+  }
+
+  if (readPhase == FT6206_READ_TAIL) {
+    readLength = readReg + readCount;
+  }
+
+  endRead (true);
+}
+
+//============================================================================================//
+/**
+  @brief  Ends the split-phase read, takes the frame into the snapshot if it was read, and
+  calls the read callback. The read is idle before the callback, so that it can start the
+  next one.
+
+  @param  success True if all phases were read.
+*/
+void CSE_FT6206:: endRead (bool success) {
+  readPhase = FT6206_READ_IDLE;
+  readStatus = FT6206_I2C_OK;
+
+  if (success) {
+    completeRead (readStartTime, readBuffer, readLength);
+  }
+  else {
+    FT6206_LOG (FT6206_LOG_ERROR, readReg, lastError);
+    i2cStats.droppedFrames++;
+    FT6206_METRIC (recordRead (readStartTime, false, false));
+  }
+
+  if (readCallback != NULL) {
+    readCallback (success);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Waits for a split-phase read in flight to end, so that a blocking access does not
+  collide with it on the bus. Each attempt is bounded by FT6206_READ_TIMEOUT_US.
+*/
+void CSE_FT6206:: waitForRead (void) {
+  while (!isReadComplete()) {
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Takes a frame that was read, or replayed from a trace, into the snapshot and runs
+  the frame processing stages.
+
+  @param  i2cdat The register data starting from FT62XX_REG_DEV_MODE.
+  @param  length The number of bytes read.
+
+  @returns True if the frame was identical to the previous one and was not decoded.
+*/
+bool CSE_FT6206:: acceptFrame (const uint8_t *i2cdat, uint8_t length) {
+  // Skip decoding when the raw frame is identical to the previous one. The filter still
+  // needs a new input, so the points are mapped again from the saved raw coordinates.
+  bool unchanged = (length == lastRawLength) && (memcmp (i2cdat, lastRaw, length) == 0);
+
+  if (!unchanged) {
+    memcpy (lastRaw, i2cdat, length);
+    lastRawLength = length;
+    decodeFrame (i2cdat, length);
+  }
+  else if (filter != NULL) {
+    for (uint8_t id = 0; id < (length - FT62XX_REG_P1_XH) / 6; id++) {
+      touchPoints [id].x = rawX [id];
+      touchPoints [id].y = rawY [id];
+      applyTransform (touchPoints [id]);
+    }
+  }
+
+  frameSeq++;
+  processFrame (unchanged);
+  return unchanged;
+}
+
+//============================================================================================//
+/**
+  @brief  Decodes the raw register data of a frame into the snapshot and maps the points to
+  the display.
+
+  @param  i2cdat The register data starting from FT62XX_REG_DEV_MODE.
+  @param  length The number of bytes read.
+*/
+void CSE_FT6206:: decodeFrame (const uint8_t *i2cdat, uint8_t length) {
+  // Save the touch count.
+  // The touch count can be 1-2 only as per the datasheet.
+  // Values other than that are invalid and read as 0.
+  touches = CSE_FT6206_Decoder:: getTouches (i2cdat);
+
+  // Save the gesture ID.
+  gestureID = i2cdat [FT62XX_REG_GEST_ID];
+
+  // Extract the touch point data from the raw data.
+  // Since we have identical set of registers for two touch points,
+  // we can run them trhough a loop of two. Adding 6 to the register
+  // is because the next identical set of registers is 6 bytes away.
+  // Points whose registers were not read are marked as having no event.
+  uint8_t points = (length - FT62XX_REG_P1_XH) / 6;
+
+  for (uint8_t id = points; id < FT6206_MAX_TOUCH_POINTS; id++) {
+    touchPoints [id].state = FT62XX_TOUCH_NONE;
+    touchArea [id] = 0;
+  }
+
+  for (uint8_t id = 0; id < points; id++) {
+    const uint8_t *p = &i2cdat [FT62XX_REG_P1_XH + (id * 6)];
+
+    touchPoints [id].state = CSE_FT6206_Decoder:: getState (p);
+    touchPoints [id].id = CSE_FT6206_Decoder:: getID (p);
+    touchPoints [id].x = CSE_FT6206_Decoder:: getX (p);
+    touchPoints [id].y = CSE_FT6206_Decoder:: getY (p);
+    touchPoints [id].z = CSE_FT6206_Decoder:: getWeight (p);
+    touchArea [id] = CSE_FT6206_Decoder:: getArea (p);
+  }
+
+  // Map the controller coordinates to the display (scale, mirroring, rotation and offset).
+  for (uint8_t id = 0; id < points; id++) {
+    rawX [id] = touchPoints [id].x;
+    rawY [id] = touchPoints [id].y;
+    applyTransform (touchPoints [id]);
+  }
+
+  #ifdef CSE_FT6206_LOG
+    FT6206_LOG (FT6206_LOG_FRAME, touches, (uint32_t (length) << 8) | gestureID);
+
+    for (uint8_t id = 0; id < points; id++) {
+      const CSE_TouchPoint &point = touchPoints [id];
+      FT6206_LOG (FT6206_LOG_POINT, (id << 7) | ((point.state & 0x03) << 4) | (point.id & 0x0F),
+        (uint32_t (uint16_t (point.y)) << 16) | uint16_t (point.x));
+    }
+  #endif
+}
+
+//============================================================================================//
+/**
+  @brief  Filters the points of every new frame before they are stored in the snapshot,
+  so that the accessors, the frame queue, the tracker and the gesture recognizer all see
+  the filtered points.
+
+  @param  filter The filter, or NULL to detach.
+*/
+void CSE_FT6206:: attachFilter (CSE_FT6206_Filter *filter) {
+  this->filter = filter;
+}
+
+//============================================================================================//
+/**
+  @brief  Feeds every new frame to a tracker, which emits down, move, up and cancel events.
+
+  @param  tracker The tracker, or NULL to detach.
+*/
+void CSE_FT6206:: attachTracker (CSE_FT6206_Tracker *tracker) {
+  this->tracker = tracker;
+}
+
+//============================================================================================//
+/**
+  @brief  Feeds every new frame to a gesture recognizer, which emits tap, double-tap,
+  long-press, swipe, pinch and rotate events.
+
+  @param  gesture The gesture recognizer, or NULL to detach.
+*/
+void CSE_FT6206:: attachGesture (CSE_FT6206_Gesture *gesture) {
+  this->gesture = gesture;
+}
+
+//============================================================================================//
+/**
+  @brief  Resolves the target under each point of every new frame, in the current rotation.
+  Read the results with the getHit() of the index.
+
+  @param  hitTest The index, or NULL to detach.
+*/
+void CSE_FT6206:: attachHitTest (CSE_FT6206_HitTest *hitTest) {
+  this->hitTest = hitTest;
+}
+
+//============================================================================================//
+/**
+  @brief  Predicts the points of every new frame by the lookahead of the predictor, after
+  the filter. Read the predicted points with the getPoint() of the predictor. The points of
+  the panel keep the measured positions.
+
+  @param  predictor The predictor, or NULL to detach.
+*/
+void CSE_FT6206:: attachPredictor (CSE_FT6206_Predictor *predictor) {
+  this->predictor = predictor;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds the points of every new frame to the history of the resampler, after the
+  filter, with the frame timestamp. Call the sample() of the resampler on every display
+  frame and read the resampled points with its getPoint().
+
+  @param  resampler The resampler, or NULL to detach.
+*/
+void CSE_FT6206:: attachResampler (CSE_FT6206_Resampler *resampler) {
+  this->resampler = resampler;
+}
+
+//============================================================================================//
+/**
+  @brief  Records every frame read from the bus by readData(), including the frames read
+  by update(), service() and the accessors, into a trace.
+
+  @param  trace The recorder, or NULL to detach.
+*/
+void CSE_FT6206:: attachTrace (CSE_FT6206_Trace *trace) {
+  this->trace = trace;
+}
+
+//============================================================================================//
+/**
+  @brief  Takes the next frame of a recorded trace as if readData() had read it. The frame
+  goes through the same decoding, transform, filter, change detection, tracker and gesture
+  stages, and the frame time is its recorded timestamp, so that a replay gives the same
+  result every time. The bus is not accessed.
+
+  @param  reader The trace, after its begin().
+
+  @returns True if a frame was processed, false at the end of the trace.
+*/
+bool CSE_FT6206:: replay (CSE_FT6206_TraceReader &reader) {
+  uint8_t i2cdat [FT6206_TRACE_MAX_FRAME];
+  uint8_t length = 0;
+  uint32_t time = 0;
+
+  // Frames shorter than the status registers cannot come from readData().
+  do {
+    if (!reader.next (time, i2cdat, length)) {
+      return false;
+    }
+  } while ((length < FT62XX_REG_P1_XH) || (length > FT62XX_FRAME_LENGTH));
+
+  frameTime = time;
+  acceptFrame (i2cdat, length);
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Runs the attached processing stages on the new frame. The filter runs first, then
+  the change detection, then the hit test, the predictor, the tracker and the gesture
+  recognizer.
+
+  @param  unchanged True if the raw frame was identical to the previous one.
+*/
+void CSE_FT6206:: processFrame (bool unchanged) {
+  if (filter != NULL) {
+    filter->apply (touchPoints, touches, frameTime);
+  }
+
+  if (unchanged && (filter == NULL)) {
+    changedMask = 0;
+    dirtyRect.x2 = dirtyRect.x1 - 1;
+  }
+  else {
+    detectChanges();
+  }
+
+  if (hitTest != NULL) {
+    hitTest->update (touchPoints, FT6206_MAX_TOUCH_POINTS, getWidth(), getHeight());
+  }
+
+  if (predictor != NULL) {
+    predictor->update (touchPoints, FT6206_MAX_TOUCH_POINTS, getWidth(), getHeight(), frameTime);
+  }
+
+  if (resampler != NULL) {
+    resampler->update (touchPoints, FT6206_MAX_TOUCH_POINTS, frameTime);
+  }
+
+  if ((tracker == NULL) && (gesture == NULL)) {
+    return;
+  }
+
+  CSE_FT6206_Frame frame;
+  getFrame (frame);
+
+  if (tracker != NULL) {
+    tracker->update (frame);
+  }
+
+  if (gesture != NULL) {
+    gesture->update (frame);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Compares the points with the previous frame. A point in contact that moved no
+  more than the hysteresis along both axes keeps its previous position. A point that
+  landed, lifted, changed its ID or moved sets its bit in the changed mask, and its old and
+  new positions are added to the dirty rectangle.
+*/
+void CSE_FT6206:: detectChanges (void) {
+  changedMask = 0;
+  dirtyRect.x1 = INT16_MAX;
+  dirtyRect.y1 = INT16_MAX;
+  dirtyRect.x2 = INT16_MIN;
+  dirtyRect.y2 = INT16_MIN;
+
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    CSE_TouchPoint &point = touchPoints [i];
+    CSE_TouchPoint &previous = reportedPoints [i];
+    bool present = (point.state != FT62XX_TOUCH_NONE);
+    bool wasPresent = (previous.state != FT62XX_TOUCH_NONE);
+
+    if (present && wasPresent && (point.state == FT62XX_TOUCH_CONTACT) && (point.id == previous.id) &&
+        (abs (point.x - previous.x) <= hysteresis) && (abs (point.y - previous.y) <= hysteresis)) {
+      point.x = previous.x;
+      point.y = previous.y;
+    }
+
+    // A touch-down followed by contact, or a lift-up followed by no touch, is not a change
+    // by itself.
+    bool stateChanged = (point.state != previous.state) &&
+      !((previous.state == FT62XX_TOUCH_DOWN) && (point.state == FT62XX_TOUCH_CONTACT)) &&
+      !((previous.state == FT62XX_TOUCH_UP) && (point.state == FT62XX_TOUCH_NONE));
+    bool changed = stateChanged || (present && ((point.id != previous.id) ||
+      (point.x != previous.x) || (point.y != previous.y)));
+
+    if (changed) {
+      changedMask |= (1 << i);
+
+      if (wasPresent) {
+        growRect (dirtyRect, previous.x, previous.y);
+      }
+
+      if (present) {
+        growRect (dirtyRect, point.x, point.y);
+      }
+    }
+
+    previous = point;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Grows a rectangle to include a point.
+*/
+void CSE_FT6206:: growRect (CSE_FT6206_Rect &rect, int16_t x, int16_t y) {
+  rect.x1 = (x < rect.x1) ? x : rect.x1;
+  rect.y1 = (y < rect.y1) ? y : rect.y1;
+  rect.x2 = (x > rect.x2) ? x : rect.x2;
+  rect.y2 = (y > rect.y2) ? y : rect.y2;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the movement below which a resting finger keeps its reported position. This
+  suppresses the jitter of a still finger. The default is 0, which reports any movement.
+
+  @param  pixels The hysteresis in pixels along each axis.
+*/
+void CSE_FT6206:: setHysteresis (uint8_t pixels) {
+  hysteresis = pixels;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the movement hysteresis in pixels.
+*/
+uint8_t CSE_FT6206:: getHysteresis (void) {
+  return hysteresis;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the points that changed in the last frame. Bit n is set if point n landed,
+  lifted, changed its ID or moved beyond the hysteresis. 0 means nothing has to be redrawn.
+*/
+uint8_t CSE_FT6206:: getChangedMask (void) {
+  return changedMask;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the bounding rectangle of the old and new positions of the points that
+  changed in the last frame, in display coordinates. It is empty (x2 < x1) if nothing
+  changed. Add the size of the drawn cursor or brush to it before redrawing.
+*/
+CSE_FT6206_Rect CSE_FT6206:: getDirtyRect (void) {
+  return dirtyRect;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads a single touch point data from the controller. This is faster than `readData()`.
+ * 
+ * @param id Touch or finger ID (0-4).
+ */
+void CSE_FT6206:: fastReadData (uint8_t id) {
+  if (id >= FT6206_MAX_TOUCH_POINTS) {
+    return;
+  }
+  
+  uint8_t i2cdat [6] = {0};
+
+  FT6206_METRIC (uint32_t readTime = micros());
+  FT6206_METRIC (metrics.fastReadCalls++);
+
+  // Read the 6 registers of the point. The point is left unchanged if the read fails.
+  if (readRegisters (FT62XX_REG_P1_XH + (id * 6), i2cdat, 6) != 6) {
+    i2cStats.droppedFrames++;
+    FT6206_METRIC (metrics.droppedFrames++);
+    FT6206_METRIC (recordLatency (metrics.fastReadLatency, metrics.maxFastReadLatency, micros() - readTime));
+    return;
+  }
+
+  // The buffer starts at the XH register of the point, so the offsets are relative to it.
+  uint16_t tempData = 0;
+
+  touchPoints [id].state = i2cdat [0] >> 6;  // Shifting right by 6 gives us the 2 MSB bits [7:6]
+  touchPoints [id].id = i2cdat [2] >> 4; // Only 4 bits are valid [7:4]
+
+  tempData = i2cdat [0] & 0x000F;  // Only the last 4 bits are the X coordinate [11:8]
+  tempData <<= 8; // Shift the MSBs to place
+  tempData |= i2cdat [1];  // Now add the LSBs [7:0]
+  touchPoints [id].x = int16_t (tempData);
+
+  tempData = i2cdat [2] & 0x000F;  // Only the last 4 bits are the Y coordinate [11:8]
+  tempData <<= 8; // Shift the MSBs to place
+  tempData |= i2cdat [3];  // Now add the LSBs [7:0]
+  touchPoints [id].y = int16_t (tempData);
+  
+  tempData = i2cdat [4];  // 8 bits of weight [7:0]
+  touchPoints [id].z = int16_t (tempData);
+
+  touchArea [id] = i2cdat [5] >> 4; // Only 4 bits are valid [7:4]
+
+  // Map the controller coordinates to the display (scale, mirroring, rotation and offset).
+  rawX [id] = touchPoints [id].x;
+  rawY [id] = touchPoints [id].y;
+  applyTransform (touchPoints [id]);
+
+  FT6206_METRIC (recordLatency (metrics.fastReadLatency, metrics.maxFastReadLatency, micros() - readTime));
+}
+
+//============================================================================================//
+/**
+  @brief  Copies the current frame snapshot into a frame.
+
+  @param  frame The frame to copy the data to.
+*/
+void CSE_FT6206:: getFrame (CSE_FT6206_Frame &frame) {
+  frame.seq = frameSeq;
+  frame.timestamp = frameTime;
+  frame.touches = touches;
+  frame.gestureID = gestureID;
+  frame.changed = changedMask;
+  frame.lostEdges = 0;
+
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    frame.points [i] = touchPoints [i];
+    frame.touchArea [i] = touchArea [i];
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the built-in interrupt mode. The falling edge of the INT line marks a
+  frame as pending, and service() reads pending frames into the queue with the timestamp
+  of the edge. The application pops frames from the queue without blocking.
+
+  @param  queue The queue to save the frames to.
+
+  @returns True if the interrupt was attached, false if there is no interrupt pin, the pin
+  cannot interrupt (always on Linux builds) or there is no free interrupt slot.
+*/
+bool CSE_FT6206:: beginInterrupt (CSE_FT6206_FrameQueue *queue) {
+  static void (*const isrs [FT6206_MAX_INTERRUPT_INSTANCES]) (void) = { isr0, isr1, isr2, isr3 };
+
+  if ((pinInterrupt < 0) || (queue == NULL) || (digitalPinToInterrupt (pinInterrupt) < 0)) {
+    return false;
+  }
+
+  endInterrupt();
+
+  for (uint8_t i = 0; i < FT6206_MAX_INTERRUPT_INSTANCES; i++) {
+    if (isrInstances [i] == NULL) {
+      interruptSlot = i;
+      break;
+    }
+  }
+
+  if (interruptSlot < 0) {
+    return false;
+  }
+
+  frameQueue = queue;
+  framePending = false;
+  servicedEdges = uint8_t (interruptCount);
+  queuedTouches = touches;
+  isrInstances [interruptSlot] = this;
+
+  pinMode (pinInterrupt, INPUT_PULLUP);
+  attachInterrupt (digitalPinToInterrupt (pinInterrupt), isrs [interruptSlot], FALLING);
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Stops the built-in interrupt mode and detaches the interrupt.
+*/
+void CSE_FT6206:: endInterrupt (void) {
+  if (interruptSlot < 0) {
+    return;
+  }
+
+  detachInterrupt (digitalPinToInterrupt (pinInterrupt));
+  isrInstances [interruptSlot] = NULL;
+  interruptSlot = -1;
+  frameQueue = NULL;
+  framePending = false;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if the built-in interrupt mode is running.
+*/
+bool CSE_FT6206:: isInterruptEnabled (void) {
+  return (frameQueue != NULL);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if an interrupt was received and the frame is not read yet.
+*/
+bool CSE_FT6206:: isFramePending (void) {
+  return framePending;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true while the INT line is low. In the polling interrupt mode the line
+  stays low while a finger is down, so this tells a touch without reading the bus.
 */
-void CSE_FT6206:: readData (void) {
-  uint8_t i2cdat [15];  // Holds the first 16 bytes of data from the FT6206
+bool CSE_FT6206:: isInterruptAsserted (void) {
+  return (pinInterrupt >= 0) && (digitalRead (pinInterrupt) == LOW);
+}
 
-  // Send the register address to start reading data from.
-  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
-  wireInstance->write (byte (FT62XX_REG_DEV_MODE));
-  wireInstance->endTransmission();
-  wireInstance->requestFrom (byte (FT62XX_I2C_ADDR), byte (15));
+//============================================================================================//
+/**
+  @brief  Returns the number of falling edges received on the INT line.
+*/
+uint32_t CSE_FT6206:: getInterruptCount (void) {
+  return interruptCount;
+}
 
-  // Read the first 16 bytes of data which have the information about the touches.
-  for (uint8_t i = 0; i < 15; i++) {
-    if (wireInstance->available()) {
-      i2cdat [i] = wireInstance->read();
-    }
+//============================================================================================//
+/**
+  @brief  Reads a pending frame from the controller and adds it to the queue. This is the
+  deferred part of the interrupt mode and should be called from the loop or a task. If the
+  INT line is still low after the read (polling interrupt mode with a finger down), the
+  next call reads again.
+
+  The controller only holds its newest frame, so service() must be called more often than
+  the scan period, 10 ms at the default active rate. Edges that arrive between two calls
+  are merged into one read, and a short tap in between can be missed completely. The
+  number of merged edges is set in lostEdges of the queued frame, which is then kept like
+  a touch-down or lift-up; a consumer that tracks fingers should treat it as a break, for
+  example with CSE_FT6206_Tracker::cancelAll(). With CSE_FT6206_METRICS they are also
+  counted in the lostEdges metric.
+
+  @returns The number of frames added to the queue (0 or 1).
+*/
+uint8_t CSE_FT6206:: service (void) {
+  if ((frameQueue == NULL) || (!framePending)) {
+    return 0;
   }
 
-  #ifdef CSE_FT6206_DEBUG
-    // Optionally print the register data
-    for (int16_t i = 0; i < 16; i++) {
-      DEBUG_SERIAL.print ("I2C Reg# ");
-      DEBUG_SERIAL.print (i, HEX);
-      DEBUG_SERIAL.print (" = 0x");
-      DEBUG_SERIAL.println (i2cdat [i], HEX);
-    }
-  #endif
+  // Clear the flag before reading, so that an edge during the read is not lost. The edges
+  // are counted in the low byte, which can be read atomically on every core. A re-read of
+  // a line that stayed low has no new edge.
+  uint32_t edgeTime = interruptTime;
+  framePending = false;
+  uint8_t edges = uint8_t (uint8_t (interruptCount) - servicedEdges);
+  bool read = readData();
 
-  // Save the touch count.
-  touches = i2cdat [FT62XX_REG_TD_STATUS];
+  FT6206_METRIC (if (read) recordLatency (metrics.interruptLatency, metrics.maxInterruptLatency, micros() - edgeTime));
 
-  // The touch count can be 1-2 only as per the datasheet.
-  // Values other than that are invalid.
-  if (touches > 2) {
-    touches = 0;
+  // A failed frame is dropped, and is read again on the next call if INT is still low.
+  if (digitalRead (pinInterrupt) == LOW) {
+    interruptTime = micros();
+    framePending = true;
   }
 
-  // Save the gesture ID.
-  gestureID = i2cdat [FT62XX_REG_GEST_ID];
+  // The edges of a failed read are reported with the next frame.
+  if (!read) {
+    return 0;
+  }
 
-  #ifdef CSE_FT6206_DEBUG
-    DEBUG_SERIAL.print ("# Touches: ");
-    DEBUG_SERIAL.println (touches);
+  uint8_t lostEdges = (edges > 1) ? (edges - 1) : 0;
+  servicedEdges += edges;
+  FT6206_METRIC (metrics.lostEdges += lostEdges);
 
-    if (i2cdat [FT62XX_REG_GEST_ID] != 0x00) {
-      DEBUG_SERIAL.print ("Gesture #");
-      DEBUG_SERIAL.println (i2cdat [FT62XX_REG_GEST_ID]);
-    }
-  #endif
+  // Frames that change the touch count, carry a touch-down or lift-up or follow merged
+  // edges are transitions.
+  bool transition = (touches != queuedTouches) || (lostEdges > 0);
 
-  // Extract the touch point data from the raw data.
-  // Since we have identical set of registers for two touch points,
-  // we can run them trhough a loop of two. Adding 6 to the register
-  // is because the next identical set of registers is 6 bytes away.
-  for (uint8_t id = 0; id < FT6206_MAX_TOUCH_POINTS; id++) {
-    // Save the touch point data.
-    uint16_t tempData = 0;
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    if ((touchPoints [i].state == FT62XX_TOUCH_DOWN) || (touchPoints [i].state == FT62XX_TOUCH_UP)) {
+      transition = true;
+    }
+  }
 
-    touchPoints [id].state = i2cdat [FT62XX_REG_P1_XH + (id * 6)] >> 6;  // Shifting right by 6 gives us the 2 MSB bits [7:6]
-    touchPoints [id].id = i2cdat [FT62XX_REG_P1_YH + (id * 6)] >> 4; // Only 4 bits are valid [7:4]
+  CSE_FT6206_Frame frame;
+  getFrame (frame);
+  frame.timestamp = edgeTime;
+  frame.lostEdges = lostEdges;
 
-    tempData = i2cdat [FT62XX_REG_P1_XH + (id * 6)] & 0x000F;  // Only the last 4 bits are the X coordinate [11:8]
-    tempData <<= 8; // Shift the MSBs to place
-    tempData |= i2cdat [FT62XX_REG_P1_XL + (id * 6)];  // Now add the LSBs [7:0]
-    touchPoints [id].x = int16_t (tempData);
+  if (!frameQueue->push (frame, transition)) {
+    return 0;
+  }
 
-    tempData = i2cdat [FT62XX_REG_P1_YH + (id * 6)] & 0x000F;  // Only the last 4 bits are the Y coordinate [11:8]
-    tempData <<= 8; // Shift the MSBs to place
-    tempData |= i2cdat [FT62XX_REG_P1_YL + (id * 6)];  // Now add the LSBs [7:0]
-    touchPoints [id].y = int16_t (tempData);
-    
-    tempData = i2cdat [FT62XX_REG_P1_WEIGHT + (id * 6)];  // 8 bits of weight [7:0]
-    touchPoints [id].z = int16_t (tempData);
+  queuedTouches = touches;
+  return 1;
+}
 
-    touchArea [id] = i2cdat [FT62XX_REG_P1_MISC + (id * 6)] >> 4; // Only 4 bits are valid [7:4]
+//============================================================================================//
+/**
+  @brief  Called from the ISR on the falling edge of the INT line. Only marks the frame as
+  pending so that the ISR stays short; the bus is never accessed from here.
+*/
+void FT6206_ISR_ATTR CSE_FT6206:: handleInterrupt (void) {
+  if (!framePending) {
+    interruptTime = micros();
   }
 
-  // Apply rotation if necessary
-  for (uint8_t id = 0; id < FT6206_MAX_TOUCH_POINTS; id++) {
-    CSE_TouchPoint point = touchPoints [id];
-  
-    switch (rotation) {
-      case 0:
-        touchPoints [id].x = point.x;
-        touchPoints [id].y = point.y;
-        break;
-      case 1:
-        touchPoints [id].x = point.y;
-        touchPoints [id].y = height - point.x; // Mirror X
-        break;
-      case 2:
-        touchPoints [id].x = width - point.x; // Mirror X
-        touchPoints [id].y = height - point.y; // Mirror Y
-        break;
-      case 3:
-        touchPoints [id].x = width - point.y; // Mirror Y
-        touchPoints [id].y = point.x;
-        break;
+  framePending = true;
+  interruptCount++;
+}
+
+void FT6206_ISR_ATTR CSE_FT6206:: isr0 (void) {
+  if (isrInstances [0] != NULL) isrInstances [0]->handleInterrupt();
+}
+
+void FT6206_ISR_ATTR CSE_FT6206:: isr1 (void) {
+  if (isrInstances [1] != NULL) isrInstances [1]->handleInterrupt();
+}
+
+void FT6206_ISR_ATTR CSE_FT6206:: isr2 (void) {
+  if (isrInstances [2] != NULL) isrInstances [2]->handleInterrupt();
+}
+
+void FT6206_ISR_ATTR CSE_FT6206:: isr3 (void) {
+  if (isrInstances [3] != NULL) isrInstances [3]->handleInterrupt();
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how readData() decides the number of bytes to read.
+
+  @param  strategy FT62XX_READ_ADAPTIVE (default) reads only the registers of the points
+  that can be active. FT62XX_READ_FULL always reads all 15 bytes.
+*/
+void CSE_FT6206:: setReadStrategy (uint8_t strategy) {
+  readStrategy = (strategy == FT62XX_READ_FULL) ? FT62XX_READ_FULL : FT62XX_READ_ADAPTIVE;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the read strategy used by readData().
+*/
+uint8_t CSE_FT6206:: getReadStrategy (void) {
+  return readStrategy;
+}
+
+//============================================================================================//
+/**
+  @brief  Reads consecutive registers in one burst, starting from the specified register.
+  The transport writes the register address and reads the data in one combined transfer.
+  A NACK or a short read is retried up to the retry budget.
+
+  @param  reg The first register to read from.
+  @param  buffer The buffer to save the data to. It can be partly overwritten on failure.
+  @param  length The number of bytes to read.
+
+  @returns The number of bytes read, or 0 if all attempts failed.
+*/
+uint8_t CSE_FT6206:: readRegisters (uint8_t reg, uint8_t *buffer, uint8_t length) {
+  waitForRead();
+
+  for (uint8_t attempt = 0; beginAttempt (attempt); attempt++) {
+    if (!selectChannel()) {
+      recordError (FT6206_I2C_BUS_ERROR);
+      continue;
+    }
+
+    uint8_t status = transport->readRegisters (i2cAddress, reg, buffer, length);
+
+    // The register address and the data, or only the address if it was not acknowledged.
+    FT6206_METRIC (metrics.bytes += ((status == FT6206_I2C_OK) || (status == FT6206_I2C_SHORT_READ)) ? (3 + length) : 2);
+
+    if (status != FT6206_I2C_OK) {
+      recordError (status);
+      continue;
     }
+
+    i2cStats.transfers++;
+    lastError = FT6206_I2C_OK;
+    FT6206_LOG (FT6206_LOG_READ, reg, (uint32_t (length) << 8) | buffer [0]);
+    return length;
   }
 
-  #ifdef CSE_FT6206_DEBUG
-    for (uint8_t i = 0; i < touches; i++) {
-      DEBUG_SERIAL.print ("ID #");
-      DEBUG_SERIAL.print (touchPoints [i].id);
-      DEBUG_SERIAL.print ("\t(");
-      DEBUG_SERIAL.print (touchPoints [i].x);
-      DEBUG_SERIAL.print (", ");
-      DEBUG_SERIAL.print (touchPoints [i].y);
-      DEBUG_SERIAL.print (", ");
-      DEBUG_SERIAL.print (touchPoints [i].z);
-      DEBUG_SERIAL.print (", ");
-      DEBUG_SERIAL.print (touchArea [i]);
-      DEBUG_SERIAL.print (", ");
-      DEBUG_SERIAL.print (touchPoints [i].state);
-      DEBUG_SERIAL.print (") ");
+  FT6206_LOG (FT6206_LOG_ERROR, reg, lastError);
+  return 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Reads the 8-bits from the specified register.
+
+  @param  reg The register to read from.
+
+  @returns The 8-bit value that was read from the register, or 0 if the read failed. Use
+  getLastError() to tell a failure from a register that holds 0.
+*/
+uint8_t CSE_FT6206:: readRegister8 (uint8_t reg) {
+  uint8_t value = 0;
+
+  readRegisters (reg, &value, 1);
+  return value;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes an 8 bit value to the specified register location.
+
+  @param  reg The register to write to.
+  @param  val The 8-bit value to write to the register.
+
+  @returns True if the controller acknowledged the write.
+*/
+bool CSE_FT6206:: writeRegister8 (uint8_t reg, uint8_t val) {
+  return writeRegisters (reg, &val, 1) == 1;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes consecutive registers with one auto-increment write, starting from the
+  specified register. A NACK is retried up to the retry budget.
+
+  @param  reg The first register to write to.
+  @param  buffer The values to write.
+  @param  length The number of bytes to write.
+
+  @returns The number of bytes written, or 0 if all attempts failed.
+*/
+uint8_t CSE_FT6206:: writeRegisters (uint8_t reg, const uint8_t *buffer, uint8_t length) {
+  waitForRead();
+
+  for (uint8_t attempt = 0; beginAttempt (attempt); attempt++) {
+    if (!selectChannel()) {
+      recordError (FT6206_I2C_BUS_ERROR);
+      continue;
     }
-    DEBUG_SERIAL.println();
-  #endif
+
+    uint8_t status = transport->writeRegisters (i2cAddress, reg, buffer, length);
+
+    FT6206_METRIC (metrics.bytes += 2 + length);
+
+    if (status != FT6206_I2C_OK) {
+      recordError (status);
+      continue;
+    }
+
+    i2cStats.transfers++;
+    lastError = FT6206_I2C_OK;
+    FT6206_LOG (FT6206_LOG_WRITE, reg, (uint32_t (length) << 8) | buffer [0]);
+    return length;
+  }
+
+  FT6206_LOG (FT6206_LOG_ERROR, reg, lastError);
+  return 0;
 }
 
 //============================================================================================//
 /**
- * @brief Reads a single touch point data from the controller. This is faster than `readData()`.
- * 
- * @param id Touch or finger ID (0-4).
- */
-void CSE_FT6206:: fastReadData (uint8_t id) {
-  if (id >= FT6206_MAX_TOUCH_POINTS) {
-    return;
+  @brief  Decides whether a transfer gets another attempt. Attempts after the first are
+  counted as retries, and are preceded by a bus recovery if SDA is held low. When the
+  budget is used up, the transfer is counted as failed.
+
+  @param  attempt The number of attempts made so far.
+
+  @returns True if the attempt should be made.
+*/
+bool CSE_FT6206:: beginAttempt (uint8_t attempt) {
+  if (attempt == 0) {
+    return true;
   }
-  
-  uint8_t i2cdat [6];
-
-  // uint8_t data = readRegister8 (FT62XX_REG_DEV_MODE);
-  // data = readRegister8 (FT62XX_REG_DEV_MODE + 1);
-  // data = readRegister8 (FT62XX_REG_DEV_MODE + 2);
-
-  // Send the register address to start reading data from.
-  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
-  wireInstance->write (byte (FT62XX_REG_P1_XH + (id * 6)));
-  wireInstance->endTransmission();
-  wireInstance->requestFrom (byte (FT62XX_I2C_ADDR), byte (6));
-
-  // Read the first 6 bytes of data which have the information about the touches.
-  for (uint8_t i = 0; i < 6; i++) {
-    if (wireInstance->available()) {
-      i2cdat [i] = wireInstance->read();
-    }
+
+  if (attempt > i2cRetries) {
+    i2cStats.failures++;
+    return false;
   }
 
-  // Save the touch point data.
-  uint16_t tempData = 0;
+  i2cStats.retries++;
 
-  touchPoints [id].state = i2cdat [FT62XX_REG_P1_XH + (id * 6)] >> 6;  // Shifting right by 6 gives us the 2 MSB bits [7:6]
-  touchPoints [id].id = i2cdat [FT62XX_REG_P1_YH + (id * 6)] >> 4; // Only 4 bits are valid [7:4]
+  if ((pinSda >= 0) && (pinScl >= 0) && (digitalRead (pinSda) == LOW)) {
+    if (!recoverBus()) {
+      // Retrying a bus that is still stuck only wastes time.
+      lastError = FT6206_I2C_BUS_STUCK;
+      i2cStats.failures++;
+      return false;
+    }
+  }
 
-  tempData = i2cdat [FT62XX_REG_P1_XH + (id * 6)] & 0x000F;  // Only the last 4 bits are the X coordinate [11:8]
-  tempData <<= 8; // Shift the MSBs to place
-  tempData |= i2cdat [FT62XX_REG_P1_XL + (id * 6)];  // Now add the LSBs [7:0]
-  touchPoints [id].x = int16_t (tempData);
+  return true;
+}
 
-  tempData = i2cdat [FT62XX_REG_P1_YH + (id * 6)] & 0x000F;  // Only the last 4 bits are the Y coordinate [11:8]
-  tempData <<= 8; // Shift the MSBs to place
-  tempData |= i2cdat [FT62XX_REG_P1_YL + (id * 6)];  // Now add the LSBs [7:0]
-  touchPoints [id].y = int16_t (tempData);
-  
-  tempData = i2cdat [FT62XX_REG_P1_WEIGHT + (id * 6)];  // 8 bits of weight [7:0]
-  touchPoints [id].z = int16_t (tempData);
+//============================================================================================//
+/**
+  @brief  Counts a failed attempt.
 
-  touchArea [id] = i2cdat [FT62XX_REG_P1_MISC + (id * 6)] >> 4; // Only 4 bits are valid [7:4]
+  @param  error One of FT6206_I2C_*.
+*/
+void CSE_FT6206:: recordError (uint8_t error) {
+  lastError = error;
 
-  // Apply rotation if necessary
-  CSE_TouchPoint point = touchPoints [id];
-  
-  switch (rotation) {
-    case 0:
-      touchPoints [id].x = point.x;
-      touchPoints [id].y = point.y;
+  switch (error) {
+    case FT6206_I2C_ADDRESS_NACK:
+      i2cStats.addressNacks++;
       break;
-    case 1:
-      touchPoints [id].x = point.y;
-      touchPoints [id].y = height - point.x; // Mirror X
+
+    case FT6206_I2C_DATA_NACK:
+      i2cStats.dataNacks++;
       break;
-    case 2:
-      touchPoints [id].x = width - point.x; // Mirror X
-      touchPoints [id].y = height - point.y; // Mirror Y
+
+    case FT6206_I2C_SHORT_READ:
+      i2cStats.shortReads++;
       break;
-    case 3:
-      touchPoints [id].x = width - point.y; // Mirror Y
-      touchPoints [id].y = point.x;
+
+    default:
+      i2cStats.busErrors++;
       break;
   }
 }
 
 //============================================================================================//
 /**
-  @brief  Reads the 8-bits from the specified register.
+  @brief  Sets how many times a failed transfer is retried. Keep it low in the render loop;
+  every attempt costs one bus transaction.
 
-  @param  reg The register to read from.
+  @param  retries The number of extra attempts. 0 disables retries.
+*/
+void CSE_FT6206:: setRetries (uint8_t retries) {
+  i2cRetries = retries;
+}
 
-  @returns The 8-bit value that was read from the register.
+//============================================================================================//
+/**
+  @brief  Returns the number of extra attempts of a failed transfer.
 */
-uint8_t CSE_FT6206:: readRegister8 (uint8_t reg) {
-  uint8_t value;
+uint8_t CSE_FT6206:: getRetries (void) {
+  return i2cRetries;
+}
 
-  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
-  wireInstance->write (byte (reg));
-  wireInstance->endTransmission();
+//============================================================================================//
+/**
+  @brief  Sets the pins used to recover the bus when a slave holds SDA low, for example
+  after a reset in the middle of a read. They must be the SDA and SCL pins of the I2C
+  peripheral used. Recovery is disabled by default.
+
+  @param  pinSda The SDA pin, -1 to disable recovery.
+  @param  pinScl The SCL pin, -1 to disable recovery.
+  @param  clock The bus clock to restore after the recovery, 0 to keep the core default.
+*/
+void CSE_FT6206:: setBusRecovery (int8_t pinSda, int8_t pinScl, uint32_t clock) {
+  this->pinSda = pinSda;
+  this->pinScl = pinScl;
+  busClock = clock;
+}
+
+//============================================================================================//
+/**
+  @brief  Recovers a bus where a slave holds SDA low. SCL is clocked up to 9 times until
+  the slave finishes the byte it was sending and releases SDA, then a STOP is generated
+  and the I2C peripheral is started again. Lines are only pulled low or released, never
+  driven high. Takes about 100 us.
 
-  wireInstance->requestFrom (byte (FT62XX_I2C_ADDR), byte (1));
+  @returns True if SDA was released.
+*/
+bool CSE_FT6206:: recoverBus (void) {
+  if ((pinSda < 0) || (pinScl < 0)) {
+    return false;
+  }
+
+  pinMode (pinSda, INPUT_PULLUP);
+  pinMode (pinScl, INPUT_PULLUP);
+  delayMicroseconds (FT6206_BUS_RECOVERY_HALF_US);
 
-  if (wireInstance->available()) {
-    value = wireInstance->read();
+  for (uint8_t i = 0; (i < FT6206_BUS_RECOVERY_CLOCKS) && (digitalRead (pinSda) == LOW); i++) {
+    digitalWrite (pinScl, LOW);
+    pinMode (pinScl, OUTPUT);
+    delayMicroseconds (FT6206_BUS_RECOVERY_HALF_US);
+    pinMode (pinScl, INPUT_PULLUP);
+    delayMicroseconds (FT6206_BUS_RECOVERY_HALF_US);
   }
 
-  #ifdef CSE_FT6206_I2C_DEBUG
-    DEBUG_SERIAL.print ("$");
-    DEBUG_SERIAL.print (reg, HEX);
-    DEBUG_SERIAL.print (": 0x");
-    DEBUG_SERIAL.println (x, HEX);
-  #endif
+  bool released = (digitalRead (pinSda) == HIGH);
 
-  return value;
+  if (released) {
+    // STOP condition: SDA rises while SCL is high.
+    digitalWrite (pinSda, LOW);
+    pinMode (pinSda, OUTPUT);
+    delayMicroseconds (FT6206_BUS_RECOVERY_HALF_US);
+    pinMode (pinSda, INPUT_PULLUP);
+    delayMicroseconds (FT6206_BUS_RECOVERY_HALF_US);
+  }
+
+  // Give the pins back to the I2C peripheral.
+  transport->begin();
+
+  if (busClock != 0) {
+    transport->setClock (busClock);
+  }
+
+  i2cStats.recoveries++;
+  return released;
 }
 
 //============================================================================================//
 /**
-  @brief  Writes an 8 bit value to the specified register location.
+  @brief  Returns the error of the last transfer, one of FT6206_I2C_*.
+*/
+uint8_t CSE_FT6206:: getLastError (void) {
+  return lastError;
+}
 
-  @param  reg The register to write to.
-  @param  val The 8-bit value to write to the register.
+//============================================================================================//
+/**
+  @brief  Returns the I2C transfer statistics.
+*/
+CSE_FT6206_I2CStats CSE_FT6206:: getI2CStats (void) {
+  return i2cStats;
+}
+
+//============================================================================================//
+/**
+  @brief  Clears the I2C transfer statistics.
+*/
+void CSE_FT6206:: resetI2CStats (void) {
+  memset (&i2cStats, 0, sizeof (i2cStats));
+}
+
+#ifdef CSE_FT6206_LOG
+
+//============================================================================================//
+/**
+  @brief  Returns the event log of the panel. Register reads and writes, failed transfers,
+  and the decoded frames and points are logged as they happen. Drain and format the records
+  from the loop, or after a problem, to see what the bus did.
+*/
+CSE_FT6206_Log &CSE_FT6206:: getLog (void) {
+  return eventLog;
+}
+
+#endif
+
+#ifdef CSE_FT6206_METRICS
+
+//============================================================================================//
+/**
+  @brief  Copies the metrics. Takes a few microseconds, so it can be called from the loop.
+
+  @param  metrics The metrics to copy to.
+*/
+void CSE_FT6206:: getMetrics (CSE_FT6206_Metrics &metrics) {
+  updateFrameRate();
+  metrics = this->metrics;
+}
+
+//============================================================================================//
+/**
+  @brief  Clears the metrics and starts a new frame rate window.
+*/
+void CSE_FT6206:: resetMetrics (void) {
+  memset (&metrics, 0, sizeof (metrics));
+  metricsWindowStart = millis();
+  metricsWindowFrames = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the latency below which the given share of the samples of a histogram
+  fall, as the upper bound of the bucket that holds it.
+
+  @param  histogram One of the latency histograms of CSE_FT6206_Metrics.
+  @param  percent The share of samples, 1 to 100.
+
+  @returns The latency in microseconds, 0 if the histogram is empty.
+*/
+uint32_t CSE_FT6206:: getPercentile (const uint32_t *histogram, uint8_t percent) {
+  uint32_t total = 0;
+
+  for (uint8_t n = 0; n < FT6206_METRICS_BUCKETS; n++) {
+    total += histogram [n];
+  }
+
+  if (total == 0) {
+    return 0;
+  }
+
+  uint32_t target = uint32_t ((uint64_t (total) * percent + 99) / 100);
+  uint32_t count = 0;
+
+  for (uint8_t n = 0; n < FT6206_METRICS_BUCKETS; n++) {
+    count += histogram [n];
+
+    if (count >= target) {
+      return (uint32_t (2) << n) - 1;
+    }
+  }
+
+  return (uint32_t (2) << (FT6206_METRICS_BUCKETS - 1)) - 1;
+}
+
+//============================================================================================//
+/**
+  @brief  Counts a readData() call.
+
+  @param  start The micros() timestamp of the start of the call.
+  @param  read True if a frame was read.
+  @param  unchanged True if the frame was identical to the previous one.
+*/
+void CSE_FT6206:: recordRead (uint32_t start, bool read, bool unchanged) {
+  recordLatency (metrics.readLatency, metrics.maxReadLatency, micros() - start);
+
+  if (!read) {
+    metrics.droppedFrames++;
+    return;
+  }
+
+  metrics.frames++;
+  metrics.duplicateFrames += unchanged ? 1 : 0;
+  metricsWindowFrames++;
+  updateFrameRate();
+}
+
+//============================================================================================//
+/**
+  @brief  Computes the frame rate when the window is complete. A window without frames
+  gives a rate of 0.
+*/
+void CSE_FT6206:: updateFrameRate (void) {
+  uint32_t elapsed = millis() - metricsWindowStart;
+
+  if (elapsed < FT6206_METRICS_WINDOW_MS) {
+    return;
+  }
+
+  metrics.frameRate = uint16_t (((metricsWindowFrames * 1000UL) + (elapsed / 2)) / elapsed);
+  metricsWindowFrames = 0;
+  metricsWindowStart += elapsed;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds a latency to a log2 histogram.
+
+  @param  histogram The histogram.
+  @param  maximum The largest latency so far, updated.
+  @param  latency The latency in microseconds.
 */
-void CSE_FT6206:: writeRegister8 (uint8_t reg, uint8_t val) {
-  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
-  wireInstance->write (byte (reg));
-  wireInstance->write (byte (val));
-  wireInstance->endTransmission();
+void CSE_FT6206:: recordLatency (uint32_t *histogram, uint32_t &maximum, uint32_t latency) {
+  uint8_t n = 0;
+
+  while (((latency >> (n + 1)) != 0) && (n < (FT6206_METRICS_BUCKETS - 1))) {
+    n++;
+  }
+
+  histogram [n]++;
+  maximum = (latency > maximum) ? latency : maximum;
 }
 
+#endif // CSE_FT6206_METRICS
+
 //============================================================================================//
@@ -9,23 +9,39 @@
   Version: 0.0.3
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_FT6206
-  Last Modified: +05:30 21:08:09 PM 28-03-2025, Friday
+  Last Modified: +05:30 01:46:30 AM 17-10-2026, Saturday
  */
 //============================================================================================//
 
 #ifndef CSE_FT6206_H // CSE_FT6206_LIBRARY
 #define CSE_FT6206_H
 
-#include "Arduino.h"
-#include <Wire.h>
-#include <CSE_Touch.h>
+#include "CSE_FT6206_Platform.h"
 
-#define DEBUG_SERIAL Serial  // Select the serial port to use for debug output
+// #define CSE_FT6206_LOG  // Uncomment this line to log the bus and frame events into a RAM ring
+// #define CSE_FT6206_METRICS  // Uncomment this line to collect the hot-path metrics
 
-// #define CSE_FT6206_DEBUG  // Uncomment this line to enable debug output
-// #define CSE_FT6206_I2C_DEBUG  // Uncomment this line to enable I2C debug output
+// The serial debug switches of the earlier versions now enable the event log.
+#if defined (CSE_FT6206_DEBUG) || defined (CSE_FT6206_I2C_DEBUG)
+  #ifndef CSE_FT6206_LOG
+    #define CSE_FT6206_LOG
+  #endif
+#endif
 
 #define FT6206_MAX_TOUCH_POINTS           2
+#define FT6206_MAX_INTERRUPT_INSTANCES    4 // Number of panels that can use the built-in interrupt mode
+
+#include "CSE_FT6206_FrameQueue.h"
+#include "CSE_FT6206_Transport.h"
+#include "CSE_FT6206_WireTransport.h"
+#include "CSE_FT6206_LinuxI2C.h"
+
+// Interrupt service routines must be placed in IRAM on ESP32 and ESP8266.
+#if defined (ARDUINO_ARCH_ESP32) || defined (ARDUINO_ARCH_ESP8266)
+  #define FT6206_ISR_ATTR                 IRAM_ATTR
+#else
+  #define FT6206_ISR_ATTR
+#endif
 
 #define FT62XX_I2C_ADDR                   0x38  // I2C address of FT6206 controller
 #define FT62XX_NUM_X                      0x33  // Touch X position
@@ -72,6 +88,8 @@
 #define FT62XX_REG_STATE                  0xBC  // Current operating mode
 
 #define FT62XX_VALUE_CHIP_ID              0x06  // Default Chip ID
+#define FT62XX_VALUE_CHIP_ID_FT6236       0x36  // Chip ID of the FT6236
+#define FT62XX_VALUE_CHIP_ID_FT6236U      0x64  // Chip ID of the FT6236U and FT6336U
 #define FT62XX_VALUE_PANEL_ID             0x11  // Default Panel ID
 #define FT62XX_VALUE_RELEASE_CODE         0x01  // Default Release Code ID
 
@@ -93,8 +111,169 @@
 #define FT62XX_INTERRUPT_POLLING          0x00  // Polling mode
 #define FT62XX_INTERRUPT_TRIGGER          0x01  // Trigger mode
 
+// FT6206 Power Modes
+#define FT62XX_PWR_ACTIVE                 0x00  // Power Mode: Active, scanning at the active rate
+#define FT62XX_PWR_MONITOR                0x01  // Power Mode: Monitor, scanning at the monitor rate
+#define FT62XX_PWR_HIBERNATE              0x03  // Power Mode: Hibernate, only a reset wakes it up
+
 #define FT62XX_DEFAULT_THRESHOLD          128 // Default threshold for touch detection
+#define FT62XX_DEFAULT_MONITOR_TIMEOUT    10  // Default seconds without touch before the monitor mode
+
+#define FT62XX_FRAME_LENGTH               15  // Registers 0x00 to 0x0E hold one touch frame
+
+#define FT62XX_CONFIG_START               0x80  // First register of the configuration shadow
+#define FT62XX_CONFIG_LENGTH              23    // Registers 0x80 to 0x96
+#define FT62XX_MODE_START                 0xA4  // First register of the mode shadow
+#define FT62XX_MODE_LENGTH                1     // Register 0xA4, PWR_MODE changes by itself and is not shadowed
+
+#define FT62XX_READ_FULL                  0x00  // Always read the whole touch frame
+#define FT62XX_READ_ADAPTIVE              0x01  // Read only the registers of the active points
+
+// Initialization states returned by poll()
+#define FT6206_INIT_IDLE                  0x00  // beginAsync() was not called yet
+#define FT6206_INIT_RESET_HIGH            0x01  // Reset pin held high before the pulse
+#define FT6206_INIT_RESET_LOW             0x02  // Reset pulse
+#define FT6206_INIT_RESET_RELEASE         0x03  // Reset pin released
+#define FT6206_INIT_WAIT_BOOT             0x04  // Waiting for the controller to boot
+#define FT6206_INIT_IDENTIFY              0x05  // Reading the chip and vendor IDs
+#define FT6206_INIT_CONFIGURE             0x06  // Writing the default configuration
+#define FT6206_INIT_READY                 0x07  // Initialization complete
+#define FT6206_INIT_FAILED                0x08  // The controller did not respond or is not an FT62xx
+
+#define FT6206_RESET_PULSE_MS             10  // Duration of each step of the reset sequence
+#define FT6206_BOOT_DELAY_MS              300 // FT6206 needs a delay after reset
+#define FT6206_IDENTIFY_TIMEOUT_MS        200 // How long to wait for the controller to ACK after the boot delay
+#define FT6206_IDENTIFY_RETRY_MS          10  // Interval between identification attempts
+
+// Identification mismatches returned by getIDMismatch()
+#define FT6206_ID_OK                      0x00  // Both IDs are known
+#define FT6206_ID_CHIP_MISMATCH           0x01  // The chip ID is not a known FT62xx, the initialization fails
+#define FT6206_ID_PANEL_MISMATCH          0x02  // The panel ID is not the default, only reported
+
+// I2C transfer errors returned by getLastError()
+#define FT6206_I2C_OK                     0x00  // The last transfer succeeded
+#define FT6206_I2C_ADDRESS_NACK           0x01  // The controller did not acknowledge its address
+#define FT6206_I2C_DATA_NACK              0x02  // The controller did not acknowledge a data byte
+#define FT6206_I2C_SHORT_READ             0x03  // Fewer bytes arrived than requested
+#define FT6206_I2C_BUS_ERROR              0x04  // Arbitration lost, timeout or other bus error
+#define FT6206_I2C_BUS_STUCK              0x05  // SDA is held low and the bus could not be recovered
+#define FT6206_I2C_PENDING                0x06  // A background read is still running, never a last error
+
+// Phases of a split-phase read started by startRead()
+#define FT6206_READ_IDLE                  0x00  // No read in flight
+#define FT6206_READ_HEAD                  0x01  // Reading the status and the predicted point registers
+#define FT6206_READ_TAIL                  0x02  // Reading the point registers beyond the prediction
+
+// Longest a background transfer may stay pending before it is counted as a bus error and
+// retried. A full frame takes under 2 ms at 100 kHz.
+#ifndef FT6206_READ_TIMEOUT_US
+  #define FT6206_READ_TIMEOUT_US          10000
+#endif
+
+#define FT6206_DEFAULT_I2C_RETRIES        2   // Extra attempts of a failed transfer
+#define FT6206_BUS_RECOVERY_CLOCKS        9   // SCL pulses to release a slave holding SDA low
+#define FT6206_BUS_RECOVERY_HALF_US       5   // Half period of the recovery clock (100 kHz)
+
+#define FT6206_METRICS_BUCKETS            16    // Latency histogram buckets, bucket n counts 2^n to 2^(n+1) - 1 us
+#define FT6206_METRICS_WINDOW_MS          1000  // Window over which the frame rate is measured
+
+#define FT6206_FRAME_AGE_UNLIMITED        0xFFFFFFFFUL  // Accessors never re-read the bus
+#define FT6206_DEFAULT_HYSTERESIS         0   // Movement in pixels that is not reported as a change
+
+#include "CSE_FT6206_Decoder.h"
+#include "CSE_FT6206_Tracker.h"
+#include "CSE_FT6206_Gesture.h"
+#include "CSE_FT6206_Filter.h"
+#include "CSE_FT6206_Predictor.h"
+#include "CSE_FT6206_Resampler.h"
+#include "CSE_FT6206_Calibration.h"
+#include "CSE_FT6206_Mux.h"
+#include "CSE_FT6206_Scheduler.h"
+#include "CSE_FT6206_Trace.h"
+#include "CSE_FT6206_Log.h"
+#include "CSE_FT6206_TraceReader.h"
+
+//============================================================================================//
+/*!
+  @brief  The writable configuration registers of the controller. Read the current values
+  with getProfile(), change them and write them back with applyProfile().
+*/
+struct CSE_FT6206_Profile {
+  uint8_t threshold;  // TH_GROUP, touch detection threshold
+  uint8_t filterCoefficient;  // TH_DIFF
+  uint8_t ctrl; // CTRL, 1 switches to the monitor mode automatically
+  uint8_t timeEnterMonitor; // TIMEENTERMONITOR, seconds without touch before the monitor mode
+  uint8_t periodActive; // PERIODACTIVE, report rate in the active mode
+  uint8_t periodMonitor;  // PERIODMONITOR, report rate in the monitor mode
+  uint8_t radianValue;  // RADIAN_VALUE
+  uint8_t offsetLeftRight;  // OFFSET_LEFT_RIGHT
+  uint8_t offsetUpDown; // OFFSET_UP_DOWN
+  uint8_t distanceLeftRight;  // DISTANCE_LEFT_RIGHT
+  uint8_t distanceUpDown; // DISTANCE_UP_DOWN
+  uint8_t distanceZoom; // DISTANCE_ZOOM
+  uint8_t interruptMode;  // G_MODE
+};
 
+//============================================================================================//
+/*!
+  @brief  A rectangle in display coordinates, with inclusive corners. It is empty when
+  x2 is less than x1.
+*/
+struct CSE_FT6206_Rect {
+  int16_t x1, y1;
+  int16_t x2, y2;
+};
+
+#include "CSE_FT6206_Power.h"
+#include "CSE_FT6206_HitTest.h"
+
+//============================================================================================//
+/*!
+  @brief  I2C transfer statistics. A transfer is one register read or write, including its
+  retries. It fails when all attempts failed.
+*/
+struct CSE_FT6206_I2CStats {
+  uint32_t transfers; // Successful transfers
+  uint32_t retries; // Extra attempts made after an error
+  uint32_t failures;  // Transfers that failed after all attempts
+  uint32_t addressNacks;
+  uint32_t dataNacks;
+  uint32_t shortReads;
+  uint32_t busErrors;
+  uint32_t recoveries;  // Bus recoveries performed
+  uint32_t droppedFrames; // Frames dropped because of a failed read
+};
+
+//============================================================================================//
+/*!
+  @brief  Called when a split-phase read ends, from the isReadComplete() call that saw the
+  end. The snapshot holds the new frame if the read succeeded.
+*/
+typedef void (*CSE_FT6206_ReadCallback) (bool success);
+
+//============================================================================================//
+/*!
+  @brief  Hot-path metrics, collected only when CSE_FT6206_METRICS is defined. Latencies
+  are in microseconds and kept as log2 histograms; bucket 0 counts 0 and 1 us, and the
+  last bucket also counts everything longer. Read latencies include the retries and the
+  frame processing stages. Bytes are counted on the wire, including the address bytes.
+*/
+struct CSE_FT6206_Metrics {
+  uint32_t readCalls; // readData() calls, including the ones made by update(), service() and the accessors
+  uint32_t fastReadCalls; // fastReadData() calls
+  uint32_t frames;  // Frames read by readData()
+  uint32_t duplicateFrames; // Frames identical to the previous one
+  uint32_t droppedFrames; // Reads that failed
+  uint32_t lostEdges; // INT edges merged by service() into a later read
+  uint32_t bytes; // I2C bytes transferred
+  uint16_t frameRate; // Frames per second over the last window
+  uint32_t maxReadLatency;
+  uint32_t maxFastReadLatency;
+  uint32_t maxInterruptLatency;
+  uint32_t readLatency [FT6206_METRICS_BUCKETS];  // readData() duration
+  uint32_t fastReadLatency [FT6206_METRICS_BUCKETS];  // fastReadData() duration
+  uint32_t interruptLatency [FT6206_METRICS_BUCKETS]; // INT edge to the end of the read in service()
+};
 
 //============================================================================================//
 /*!
@@ -116,11 +295,30 @@ class CSE_FT6206 {
 
     CSE_TouchPoint touchPoints [FT6206_MAX_TOUCH_POINTS];
 
+    // The above values form the frame snapshot. They are filled by one update() or
+    // readData() call, and all accessors serve from them.
+    uint32_t frameSeq;  // Incremented on every frame read, 0 if no frame was read yet
+    uint32_t frameTime; // micros() timestamp of the last frame read
+
+#if !defined (CSE_FT6206_POSIX)
     CSE_FT6206 (uint16_t width, uint16_t height, TwoWire *i2c = &Wire, int8_t pinRst = -1, int8_t pinIrq = -1);
+#endif
+    CSE_FT6206 (uint16_t width, uint16_t height, CSE_FT6206_Transport *transport, int8_t pinRst = -1, int8_t pinIrq = -1);
 
     // Initialization functions.
     
     bool begin();
+    bool beginAsync (void); // Starts the initialization without blocking
+    uint8_t poll (void);  // Runs the next due initialization step, returns FT6206_INIT_*
+    uint8_t getInitState (void);
+    uint8_t getChipID (void);
+    uint8_t getVendorID (void);
+    uint8_t getIDMismatch (void); // FT6206_ID_* flags of the last identification
+    void setAddress (uint8_t address = FT62XX_I2C_ADDR); // I2C address of this controller
+    uint8_t getAddress (void);
+    void attachMux (CSE_FT6206_Mux *mux, uint8_t channel);  // The controller is behind a multiplexer channel
+    CSE_FT6206_Mux *getMux (void);
+    uint8_t getMuxChannel (void);
 
     // Configuration functions.
 
@@ -131,17 +329,86 @@ class CSE_FT6206 {
     bool setActiveScanRate (uint8_t rate = 6);
     uint8_t getInterruptMode (void);
     bool setInterruptMode (uint8_t mode = 1);
+    bool getAutoMonitor (void);
+    bool setAutoMonitor (bool enable = true); // The controller enters the monitor mode when idle
+    uint8_t getMonitorTimeout (void);
+    bool setMonitorTimeout (uint8_t seconds = FT62XX_DEFAULT_MONITOR_TIMEOUT);
+    uint8_t getPowerMode (void);
+    bool setPowerMode (uint8_t mode = FT62XX_PWR_ACTIVE); // One of FT62XX_PWR_*
+    bool hibernate (void);  // Stops the controller until wake()
+    bool wake (void); // Resets the controller, then poll() until ready
+    bool refreshConfig (void); // Reads the configuration registers into the shadow
+    bool getProfile (CSE_FT6206_Profile &profile);
+    bool applyProfile (const CSE_FT6206_Profile &profile);  // Writes the changed registers and verifies them
 
     // Data functions.
 
-    void readData (void);
+    bool update (void);  // Reads a new frame into the snapshot
+    bool readData (void);
     void fastReadData (uint8_t id = 0);
+    void setMaxFrameAge (uint32_t us = FT6206_FRAME_AGE_UNLIMITED); // Staleness budget of the accessors
+    uint32_t getMaxFrameAge (void);
+    uint32_t getFrameSeq (void);
+    uint32_t getFrameTime (void);
+    uint32_t getFrameAge (void);
+    void setReadStrategy (uint8_t strategy = FT62XX_READ_ADAPTIVE);
+    uint8_t getReadStrategy (void);
+    void getFrame (CSE_FT6206_Frame &frame); // Copies the snapshot into a frame
+    void setHysteresis (uint8_t pixels = FT6206_DEFAULT_HYSTERESIS);  // Smaller movements are not reported
+    uint8_t getHysteresis (void);
+    uint8_t getChangedMask (void);  // Bit n is set if point n changed in the last frame
+    CSE_FT6206_Rect getDirtyRect (void); // Area the points moved across in the last frame
+
+    // Split-phase read functions.
+
+    bool startRead (void);  // Starts a frame read without waiting, false if one is in flight
+    bool isReadComplete (void); // Advances the read, true when none is in flight
+    uint8_t getReadPhase (void);  // One of FT6206_READ_*
+    void setReadCallback (CSE_FT6206_ReadCallback callback); // Called when a read ends
+
+    // Interrupt functions.
+
+    bool beginInterrupt (CSE_FT6206_FrameQueue *queue);  // Starts the built-in interrupt mode
+    void endInterrupt (void);
+    bool isInterruptEnabled (void);
+    bool isFramePending (void);
+    bool isInterruptAsserted (void);  // True while the INT line is low
+    uint8_t service (void); // Reads pending frames into the queue, call from the loop
+    uint32_t getInterruptCount (void);
+
+    // Metrics functions, only available with CSE_FT6206_METRICS.
+
+    #ifdef CSE_FT6206_METRICS
+      void getMetrics (CSE_FT6206_Metrics &metrics);  // Copies the metrics
+      void resetMetrics (void);
+      static uint32_t getPercentile (const uint32_t *histogram, uint8_t percent); // Upper bound of the bucket in us
+    #endif
+
+    // Event log functions, only available with CSE_FT6206_LOG.
+
+    #ifdef CSE_FT6206_LOG
+      CSE_FT6206_Log &getLog (void);  // Drain it from the loop to see the bus and frame events
+    #endif
+
+    // Trace functions.
+
+    void attachTrace (CSE_FT6206_Trace *trace); // Records every frame read from the bus
+    bool replay (CSE_FT6206_TraceReader &reader); // Processes the next recorded frame instead of a bus read
+
+    // Frame processing functions.
+
+    void attachFilter (CSE_FT6206_Filter *filter);  // Filters the points of every new frame first
+    void attachTracker (CSE_FT6206_Tracker *tracker);  // Feeds every new frame to a tracker
+    void attachGesture (CSE_FT6206_Gesture *gesture);  // Feeds every new frame to a gesture recognizer
+    void attachHitTest (CSE_FT6206_HitTest *hitTest);  // Resolves the target under the points of every new frame
+    void attachPredictor (CSE_FT6206_Predictor *predictor);  // Predicts the points of every new frame ahead of time
+    void attachResampler (CSE_FT6206_Resampler *resampler);  // Keeps the points of every new frame for resampling
     bool isTouched (void); // Returns true if there are any touches detected
     bool isTouched (uint8_t id); // Returns true if there are any touches detected
     CSE_TouchPoint getPoint (uint8_t n = 0);  // By default, P1 touch point is returned
     uint8_t getTouches (void);  // Returns the number of touches detected
     uint8_t getGestureID (void);
-    String getGestureName (void);
+    const char *getGestureName (void);
     
     // Utility functions.
 
@@ -149,19 +416,167 @@ class CSE_FT6206 {
     uint8_t getRotation();  // Set the rotation of the touch panel (0-3
     uint16_t getWidth();
     uint16_t getHeight();
+    void setTouchResolution (uint16_t w = 0, uint16_t h = 0); // Native resolution of the controller
+    void setMirror (bool x = false, bool y = false);
+    void setOffset (int16_t x = 0, int16_t y = 0);
+    CSE_FT6206_Affine getTransform (void);
+    void setCalibration (const CSE_FT6206_Affine &coefficients);  // Replaces the resolution scaling and mirroring
+    void clearCalibration (void);
+    bool isCalibrated (void);
+    CSE_TouchPoint getRawPoint (uint8_t n = 0); // Point in the controller coordinates, for calibration
 
     // Data transfer functions.
 
-    void writeRegister8 (uint8_t reg, uint8_t val); // Write an 8 bit value to a register
-    uint8_t readRegister8 (uint8_t reg);  // Read an 8 bit value from a register
+    bool writeRegister8 (uint8_t reg, uint8_t val); // Write an 8 bit value to a register
+    uint8_t readRegister8 (uint8_t reg);  // Read an 8 bit value from a register, 0 on error
+    uint8_t readRegisters (uint8_t reg, uint8_t *buffer, uint8_t length); // Read consecutive registers
+    uint8_t writeRegisters (uint8_t reg, const uint8_t *buffer, uint8_t length); // Write consecutive registers
+
+    // Error handling functions.
+
+    void setRetries (uint8_t retries = FT6206_DEFAULT_I2C_RETRIES); // Extra attempts of a failed transfer
+    uint8_t getRetries (void);
+    void setBusRecovery (int8_t pinSda, int8_t pinScl, uint32_t clock = 0);  // Pins used to unstick the bus
+    bool recoverBus (void); // Clocks SCL until SDA is released and restarts the I2C peripheral
+    uint8_t getLastError (void);  // One of FT6206_I2C_*
+    CSE_FT6206_I2CStats getI2CStats (void);
+    void resetI2CStats (void);
 
   private:
-    TwoWire *wireInstance; // Touch panel I2C
+#if !defined (CSE_FT6206_POSIX)
+    CSE_FT6206_WireTransport wireTransport; // Used when the panel is on a TwoWire bus
+#endif
+    CSE_FT6206_Transport *transport; // Touch panel I2C
+    uint8_t i2cAddress;
+    CSE_FT6206_Mux *mux;  // NULL if the controller is directly on the bus
+    uint8_t muxChannel;
     int8_t pinReset;  // Touch panel reset pin
     int8_t pinInterrupt;  // Touch panel reset pin
     bool inited;
+    uint8_t initState;  // One of FT6206_INIT_*
+    uint32_t initDeadline;  // millis() after which the current initialization step is due
+    uint32_t initTimeout; // millis() after which identification gives up
+    uint8_t chipID;
+    uint8_t vendorID;
+    uint8_t idMismatch;
+    uint32_t maxFrameAge; // Accessors re-read the bus if the snapshot is older than this
+    uint8_t readStrategy; // How readData() decides the number of bytes to read
+
+    // Shadow of the configuration (0x80-0x96) and interrupt mode (0xA4) registers.
+    uint8_t configShadow [FT62XX_CONFIG_LENGTH + FT62XX_MODE_LENGTH];
+    bool configValid; // False until the shadow is read, and after a reset
+
+    uint8_t readConfig (uint8_t reg);
+    bool writeConfig (uint8_t reg, const uint8_t *values, uint8_t length);
+    static int8_t shadowIndex (uint8_t reg);
+
+    // I2C error handling.
+    uint8_t i2cRetries;
+    int8_t pinSda, pinScl;  // Bus recovery pins, -1 if recovery is disabled
+    uint32_t busClock;  // Clock restored after a recovery, 0 to keep the default
+    uint8_t lastError;
+    CSE_FT6206_I2CStats i2cStats;
+
+    bool beginAttempt (uint8_t attempt);
+    bool selectChannel (void);
+    bool probe (void);
+    void recordError (uint8_t error);
+    void init (uint16_t width, uint16_t height, CSE_FT6206_Transport *transport, int8_t pinRst, int8_t pinIrq);
+
+    void refreshFrame (void);
+    void completeRead (uint32_t readTime, const uint8_t *i2cdat, uint8_t length);
+    void decodeFrame (const uint8_t *i2cdat, uint8_t length);
+    void setInitState (uint8_t state, uint32_t delayMs);
+
+    // Coordinate transform, recomputed only when one of its inputs changes.
+    CSE_FT6206_Affine transform;
+    uint16_t touchWidth, touchHeight; // Native resolution of the controller, 0 if same as the display
+    bool mirrorX, mirrorY;
+    int16_t offsetX, offsetY;
+    bool calibrated;
+    CSE_FT6206_Affine calibration;  // Maps the controller coordinates to the unrotated display
+    int16_t rawX [FT6206_MAX_TOUCH_POINTS], rawY [FT6206_MAX_TOUCH_POINTS];  // Points before the transform
+
+    void updateTransform (void);
+    void applyTransform (CSE_TouchPoint &point);
+    static CSE_FT6206_Affine composeAffine (const CSE_FT6206_Affine &outer, const CSE_FT6206_Affine &inner);
+
+    // Frame processing stages, run on every new frame.
+    CSE_FT6206_Filter *filter;
+    CSE_FT6206_Tracker *tracker;
+    CSE_FT6206_Gesture *gesture;
+    CSE_FT6206_HitTest *hitTest;
+    CSE_FT6206_Predictor *predictor;
+    CSE_FT6206_Resampler *resampler;
+    CSE_FT6206_Trace *trace;
+
+    // Change detection
+    uint8_t lastRaw [FT62XX_FRAME_LENGTH];  // Raw registers of the last frame
+    uint8_t lastRawLength;  // Number of valid bytes in lastRaw, 0 to force decoding
+    uint8_t hysteresis;
+    uint8_t changedMask;
+    CSE_FT6206_Rect dirtyRect;
+    CSE_TouchPoint reportedPoints [FT6206_MAX_TOUCH_POINTS]; // Points of the previous frame
+
+    bool acceptFrame (const uint8_t *i2cdat, uint8_t length);
+    void processFrame (bool unchanged = false);
+    void detectChanges (void);
+    static void growRect (CSE_FT6206_Rect &rect, int16_t x, int16_t y);
+
+    // Split-phase read.
+    uint8_t readPhase;  // One of FT6206_READ_*
+    uint8_t readStatus; // Result of a blocking fallback read, FT6206_I2C_PENDING while the transport runs it
+    uint8_t readAttempt;
+    uint8_t readReg;  // First register of the phase, also its offset in readBuffer
+    uint8_t readCount;  // Registers read by the phase
+    uint8_t readLength; // Bytes of the frame read by the head phase, and the tail phase when needed
+    uint32_t readStartTime;
+    uint32_t readDeadline;  // micros() after which a pending transfer has failed
+    uint8_t readBuffer [FT62XX_FRAME_LENGTH];
+    CSE_FT6206_ReadCallback readCallback;
+
+    bool startTransfer (void);
+    void stepRead (uint8_t status);
+    void endRead (bool success);
+    void waitForRead (void);
+
+    // Event log.
+    #ifdef CSE_FT6206_LOG
+      CSE_FT6206_Log eventLog;
+    #endif
+
+    // Hot-path metrics.
+    #ifdef CSE_FT6206_METRICS
+      CSE_FT6206_Metrics metrics;
+      uint32_t metricsWindowStart;  // millis() at the start of the frame rate window
+      uint32_t metricsWindowFrames;
+
+      void recordRead (uint32_t start, bool read, bool unchanged);
+      void updateFrameRate (void);
+      static void recordLatency (uint32_t *histogram, uint32_t &maximum, uint32_t latency);
+    #endif
+
+    // Built-in interrupt mode.
+    CSE_FT6206_FrameQueue *frameQueue;
+    volatile bool framePending; // Set by the ISR on the falling edge of INT
+    volatile uint32_t interruptTime;  // micros() timestamp of the first unserviced edge
+    volatile uint32_t interruptCount;
+    uint8_t servicedEdges;  // Low byte of interruptCount at the last service()
+    int8_t interruptSlot; // Index in isrInstances, -1 if not attached
+    uint8_t queuedTouches;  // Touch count of the last queued frame
+
+    void handleInterrupt (void);
+    static CSE_FT6206 *isrInstances [FT6206_MAX_INTERRUPT_INSTANCES];
+    static void FT6206_ISR_ATTR isr0 (void);
+    static void FT6206_ISR_ATTR isr1 (void);
+    static void FT6206_ISR_ATTR isr2 (void);
+    static void FT6206_ISR_ATTR isr3 (void);
 };
 
 //============================================================================================//
 
+#if !defined (CSE_FT6206_POSIX)
+  #include "CSE_FT6206_Lite.h" // Talks to TwoWire directly
+#endif
+
 #endif // CSE_FT6206_LIBRARY
@@ -0,0 +1,368 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Calibration.cpp
+  Description: Multi-point touch calibration for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 02:26:03 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206_Calibration.h"
+
+#define FT6206_CAL_MAGIC_0                0x46  // 'F'
+#define FT6206_CAL_MAGIC_1                0x36  // '6'
+#define FT6206_CAL_MAX_ERROR_CP           30000 // Residuals are clamped to 300 pixels
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new calibration with the identity transform.
+*/
+CSE_FT6206_Calibration:: CSE_FT6206_Calibration() {
+  clear();
+}
+
+//============================================================================================//
+/**
+  @brief  Removes all point pairs and resets the coefficients to the identity transform.
+*/
+void CSE_FT6206_Calibration:: clear (void) {
+  count = 0;
+  valid = false;
+  maxError = 0;
+  rmsError = 0;
+  coefficients.a = FT6206_AFFINE_ONE;
+  coefficients.b = 0;
+  coefficients.c = 0;
+  coefficients.d = 0;
+  coefficients.e = FT6206_AFFINE_ONE;
+  coefficients.f = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds a pair of a display target point and the raw controller point measured
+  when touching it. Use CSE_FT6206::getRawPoint() to get the raw point.
+
+  @returns False if the maximum number of points was reached.
+*/
+bool CSE_FT6206_Calibration:: addPoint (int16_t targetX, int16_t targetY, int16_t rawX, int16_t rawY) {
+  if (count >= FT6206_CAL_MAX_POINTS) {
+    return false;
+  }
+
+  targets [count][0] = targetX;
+  targets [count][1] = targetY;
+  raws [count][0] = rawX;
+  raws [count][1] = rawY;
+  count++;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of point pairs added.
+*/
+uint8_t CSE_FT6206_Calibration:: getPointCount (void) {
+  return count;
+}
+
+//============================================================================================//
+/**
+  @brief  Solves the affine transform as a least-squares fit of the point pairs.
+
+  The raw points are centered on their (rounded) mean so that the sums fit in 32 bits and
+  the 2x2 normal equations fit in 64 bits. The slopes are then solved with Cramer's rule
+  and the offsets are computed from the exact means.
+
+  @returns True if solved, false if there are too few points or they are collinear.
+*/
+bool CSE_FT6206_Calibration:: solve (void) {
+  valid = false;
+
+  if (count < FT6206_CAL_MIN_POINTS) {
+    return false;
+  }
+
+  int32_t sumRx = 0, sumRy = 0, sumTx = 0, sumTy = 0;
+
+  for (uint8_t i = 0; i < count; i++) {
+    sumRx += raws [i][0];
+    sumRy += raws [i][1];
+    sumTx += targets [i][0];
+    sumTy += targets [i][1];
+  }
+
+  int32_t meanRx = (sumRx + (count / 2)) / count;
+  int32_t meanRy = (sumRy + (count / 2)) / count;
+  int32_t meanTx = (sumTx + (count / 2)) / count;
+  int32_t meanTy = (sumTy + (count / 2)) / count;
+
+  int32_t sxx = 0, sxy = 0, syy = 0, sxu = 0, syu = 0, sxv = 0, syv = 0;
+
+  for (uint8_t i = 0; i < count; i++) {
+    int32_t x = raws [i][0] - meanRx;
+    int32_t y = raws [i][1] - meanRy;
+    int32_t u = targets [i][0] - meanTx;
+    int32_t v = targets [i][1] - meanTy;
+
+    sxx += x * x;
+    sxy += x * y;
+    syy += y * y;
+    sxu += x * u;
+    syu += y * u;
+    sxv += x * v;
+    syv += y * v;
+  }
+
+  int64_t det = (int64_t (sxx) * syy) - (int64_t (sxy) * sxy);
+
+  if (det <= 0) {
+    return false; // Collinear or coincident points
+  }
+
+  CSE_FT6206_Affine m;
+  m.a = divideQ16 ((int64_t (sxu) * syy) - (int64_t (sxy) * syu), det);
+  m.b = divideQ16 ((int64_t (sxx) * syu) - (int64_t (sxy) * sxu), det);
+  m.d = divideQ16 ((int64_t (sxv) * syy) - (int64_t (sxy) * syv), det);
+  m.e = divideQ16 ((int64_t (sxx) * syv) - (int64_t (sxy) * sxv), det);
+
+  // c = mean (target) - a * mean (raw x) - b * mean (raw y), in Q16.
+  m.c = int32_t (((int64_t (sumTx) << FT6206_AFFINE_SHIFT) - (int64_t (m.a) * sumRx) - (int64_t (m.b) * sumRy)) / count);
+  m.f = int32_t (((int64_t (sumTy) << FT6206_AFFINE_SHIFT) - (int64_t (m.d) * sumRx) - (int64_t (m.e) * sumRy)) / count);
+
+  coefficients = m;
+  valid = true;
+  computeResiduals();
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if the coefficients were solved or restored from a blob.
+*/
+bool CSE_FT6206_Calibration:: isValid (void) {
+  return valid;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the solved coefficients. Pass them to CSE_FT6206::setCalibration().
+*/
+const CSE_FT6206_Affine &CSE_FT6206_Calibration:: getCoefficients (void) {
+  return coefficients;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the largest distance between a target and its mapped raw point, in 1/100
+  pixels.
+*/
+uint16_t CSE_FT6206_Calibration:: getMaxError (void) {
+  return maxError;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the RMS distance between the targets and the mapped raw points, in 1/100
+  pixels. This is 0 after restoring from a blob, since the points are not stored.
+*/
+uint16_t CSE_FT6206_Calibration:: getRmsError (void) {
+  return rmsError;
+}
+
+//============================================================================================//
+/**
+  @brief  Saves the coefficients to a byte blob that can be stored in EEPROM or NVS.
+
+  The layout is 2 magic bytes, the version, the number of points used, the six
+  coefficients as little-endian 32-bit integers, the max error as a little-endian 16-bit
+  integer and a CRC-8 of all the previous bytes.
+
+  @param  buffer The buffer to write to.
+  @param  size The size of the buffer. Must be at least FT6206_CAL_BLOB_SIZE.
+
+  @returns The number of bytes written, or 0 if not solved or the buffer is too small.
+*/
+uint8_t CSE_FT6206_Calibration:: serialize (uint8_t *buffer, uint8_t size) {
+  if ((!valid) || (buffer == NULL) || (size < FT6206_CAL_BLOB_SIZE)) {
+    return 0;
+  }
+
+  const int32_t values [6] = { coefficients.a, coefficients.b, coefficients.c,
+                               coefficients.d, coefficients.e, coefficients.f };
+  uint8_t n = 0;
+
+  buffer [n++] = FT6206_CAL_MAGIC_0;
+  buffer [n++] = FT6206_CAL_MAGIC_1;
+  buffer [n++] = FT6206_CAL_BLOB_VERSION;
+  buffer [n++] = count;
+
+  for (uint8_t i = 0; i < 6; i++) {
+    uint32_t value = uint32_t (values [i]);
+
+    for (uint8_t b = 0; b < 4; b++) {
+      buffer [n++] = uint8_t (value >> (8 * b));
+    }
+  }
+
+  buffer [n++] = uint8_t (maxError);
+  buffer [n++] = uint8_t (maxError >> 8);
+  buffer [n] = crc8 (buffer, n);
+  n++;
+
+  return n;
+}
+
+//============================================================================================//
+/**
+  @brief  Restores the coefficients from a blob written by serialize(). The point pairs
+  are not restored.
+
+  @returns True if the blob is valid, false if the magic, version, size or CRC is wrong.
+*/
+bool CSE_FT6206_Calibration:: deserialize (const uint8_t *buffer, uint8_t size) {
+  if ((buffer == NULL) || (size < FT6206_CAL_BLOB_SIZE)) {
+    return false;
+  }
+
+  if ((buffer [0] != FT6206_CAL_MAGIC_0) || (buffer [1] != FT6206_CAL_MAGIC_1) ||
+      (buffer [2] != FT6206_CAL_BLOB_VERSION)) {
+    return false;
+  }
+
+  if (crc8 (buffer, FT6206_CAL_BLOB_SIZE - 1) != buffer [FT6206_CAL_BLOB_SIZE - 1]) {
+    return false;
+  }
+
+  int32_t values [6];
+  uint8_t n = 4;
+
+  for (uint8_t i = 0; i < 6; i++) {
+    uint32_t value = 0;
+
+    for (uint8_t b = 0; b < 4; b++) {
+      value |= uint32_t (buffer [n++]) << (8 * b);
+    }
+
+    values [i] = int32_t (value);
+  }
+
+  clear();
+  coefficients.a = values [0];
+  coefficients.b = values [1];
+  coefficients.c = values [2];
+  coefficients.d = values [3];
+  coefficients.e = values [4];
+  coefficients.f = values [5];
+  maxError = uint16_t (buffer [n] | (uint16_t (buffer [n + 1]) << 8));
+  valid = true;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Computes the max and RMS residuals of the point pairs with the solved
+  coefficients.
+*/
+void CSE_FT6206_Calibration:: computeResiduals (void) {
+  uint64_t sumSq = 0;
+  maxError = 0;
+
+  for (uint8_t i = 0; i < count; i++) {
+    int64_t x = raws [i][0];
+    int64_t y = raws [i][1];
+    int64_t dx = (coefficients.a * x) + (coefficients.b * y) + coefficients.c - (int64_t (targets [i][0]) << FT6206_AFFINE_SHIFT);
+    int64_t dy = (coefficients.d * x) + (coefficients.e * y) + coefficients.f - (int64_t (targets [i][1]) << FT6206_AFFINE_SHIFT);
+
+    // Convert to 1/100 pixels and clamp so that the squares fit in 32 bits.
+    int32_t cx = int32_t ((dx * 100) / FT6206_AFFINE_ONE);
+    int32_t cy = int32_t ((dy * 100) / FT6206_AFFINE_ONE);
+    cx = constrain (cx, -FT6206_CAL_MAX_ERROR_CP, FT6206_CAL_MAX_ERROR_CP);
+    cy = constrain (cy, -FT6206_CAL_MAX_ERROR_CP, FT6206_CAL_MAX_ERROR_CP);
+
+    uint32_t sq = uint32_t (cx * cx) + uint32_t (cy * cy);
+    uint16_t error = uint16_t (sqrt32 (sq));
+
+    maxError = (error > maxError) ? error : maxError;
+    sumSq += sq;
+  }
+
+  rmsError = (count > 0) ? uint16_t (sqrt32 (uint32_t (sumSq / count))) : 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns numerator / denominator in Q16. Both are scaled down first so that the
+  shifted numerator fits in 64 bits.
+*/
+int32_t CSE_FT6206_Calibration:: divideQ16 (int64_t numerator, int64_t denominator) {
+  const int64_t limit = int64_t (1) << 46;
+
+  while ((numerator >= limit) || (numerator <= -limit) || (denominator >= limit)) {
+    numerator /= 2;
+    denominator /= 2;
+  }
+
+  if (denominator == 0) {
+    return 0;
+  }
+
+  int64_t scaled = numerator * FT6206_AFFINE_ONE;
+  int64_t half = denominator / 2;
+
+  return int32_t ((scaled >= 0) ? ((scaled + half) / denominator) : ((scaled - half) / denominator));
+}
+
+//============================================================================================//
+/**
+  @brief  Integer square root.
+*/
+uint32_t CSE_FT6206_Calibration:: sqrt32 (uint32_t value) {
+  uint32_t result = 0;
+  uint32_t bit = uint32_t (1) << 30;
+
+  while (bit > value) {
+    bit >>= 2;
+  }
+
+  while (bit != 0) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return result;
+}
+
+//============================================================================================//
+/**
+  @brief  CRC-8 with the polynomial 0x07.
+*/
+uint8_t CSE_FT6206_Calibration:: crc8 (const uint8_t *data, uint8_t length) {
+  uint8_t crc = 0;
+
+  for (uint8_t i = 0; i < length; i++) {
+    crc ^= data [i];
+
+    for (uint8_t b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? uint8_t ((crc << 1) ^ 0x07) : uint8_t (crc << 1);
+    }
+  }
+
+  return crc;
+}
+
+//============================================================================================//
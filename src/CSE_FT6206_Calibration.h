@@ -0,0 +1,84 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Calibration.h
+  Description: Multi-point touch calibration for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_CALIBRATION_H
+#define CSE_FT6206_CALIBRATION_H
+
+#include "CSE_FT6206_Platform.h"
+
+#define FT6206_CAL_MIN_POINTS             3 // Minimum number of point pairs to solve
+#define FT6206_CAL_MAX_POINTS             5 // Maximum number of point pairs
+#define FT6206_CAL_BLOB_VERSION           1 // Version of the serialized coefficient blob
+#define FT6206_CAL_BLOB_SIZE              31  // Size of the serialized coefficient blob in bytes
+
+#define FT6206_AFFINE_SHIFT               16  // Fractional bits of the affine coefficients
+#define FT6206_AFFINE_ONE                 (int32_t (1) << FT6206_AFFINE_SHIFT)
+#define FT6206_AFFINE_HALF                (int32_t (1) << (FT6206_AFFINE_SHIFT - 1))
+
+//============================================================================================//
+/*!
+  @brief  Fixed-point affine transform from the controller coordinates to the display.
+  x' = (a * x + b * y + c) >> 16 and y' = (d * x + e * y + f) >> 16. The scale factors
+  must be below 8 so that the products fit in 32 bits.
+*/
+struct CSE_FT6206_Affine {
+  int32_t a, b, c;
+  int32_t d, e, f;
+};
+
+//============================================================================================//
+/*!
+  @brief  Solves the affine transform from 3 to 5 pairs of display target points and the
+  raw controller points measured when touching them. The solution is a least-squares fit
+  in fixed point, and can be saved to and restored from a small versioned byte blob so that
+  it does not have to be solved again at boot.
+
+  The targets are in the unrotated display coordinates (rotation 0). The solved transform
+  replaces the touch resolution scaling of the driver, and mirroring is absorbed into it.
+*/
+class CSE_FT6206_Calibration {
+  public:
+    CSE_FT6206_Calibration();
+
+    void clear (void);
+    bool addPoint (int16_t targetX, int16_t targetY, int16_t rawX, int16_t rawY);
+    uint8_t getPointCount (void);
+    bool solve (void);  // Returns false if there are too few points or they are collinear
+    bool isValid (void);
+
+    const CSE_FT6206_Affine &getCoefficients (void);
+    uint16_t getMaxError (void);  // Largest residual in 1/100 pixels
+    uint16_t getRmsError (void);  // RMS residual in 1/100 pixels
+
+    uint8_t serialize (uint8_t *buffer, uint8_t size); // Returns the number of bytes written
+    bool deserialize (const uint8_t *buffer, uint8_t size);
+
+  private:
+    int16_t targets [FT6206_CAL_MAX_POINTS][2];
+    int16_t raws [FT6206_CAL_MAX_POINTS][2];
+    uint8_t count;
+    bool valid;
+    CSE_FT6206_Affine coefficients;
+    uint16_t maxError;
+    uint16_t rmsError;
+
+    void computeResiduals (void);
+    static int32_t divideQ16 (int64_t numerator, int64_t denominator);
+    static uint32_t sqrt32 (uint32_t value);
+    static uint8_t crc8 (const uint8_t *data, uint8_t length);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_CALIBRATION_H
@@ -0,0 +1,132 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Decoder.cpp
+  Description: Stateless decoder of raw touch frames for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 08:41:53 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Decodes one frame as read by readData() into the caller buffers. Points whose
+  registers are not in the frame are stored with the FT62XX_TOUCH_NONE state and zero
+  fields.
+
+  @param  frame The register data starting from FT62XX_REG_DEV_MODE.
+  @param  length The number of bytes in the frame.
+  @param  out The buffers.
+  @param  index The entry of the buffers to fill.
+
+  @returns The number of touches, 0 if the count is invalid.
+*/
+uint8_t CSE_FT6206_Decoder:: decode (const uint8_t *frame, uint8_t length, const CSE_FT6206_PointArrays &out, uint32_t index) {
+  uint8_t points = (length < FT62XX_REG_P1_XH) ? 0 : ((length - FT62XX_REG_P1_XH) / 6);
+  uint8_t touches = (length > FT62XX_REG_TD_STATUS) ? getTouches (frame) : 0;
+
+  if (out.touches != NULL) {
+    out.touches [index] = touches;
+  }
+
+  if (out.gesture != NULL) {
+    out.gesture [index] = (length > FT62XX_REG_GEST_ID) ? frame [FT62XX_REG_GEST_ID] : 0;
+  }
+
+  for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+    const uint8_t *p = &frame [FT62XX_REG_P1_XH + (n * 6)];
+    bool present = (n < points);
+
+    if (out.x [n] != NULL) {
+      out.x [n][index] = present ? getX (p) : 0;
+    }
+
+    if (out.y [n] != NULL) {
+      out.y [n][index] = present ? getY (p) : 0;
+    }
+
+    if (out.z [n] != NULL) {
+      out.z [n][index] = present ? getWeight (p) : 0;
+    }
+
+    if (out.state [n] != NULL) {
+      out.state [n][index] = present ? getState (p) : FT62XX_TOUCH_NONE;
+    }
+
+    if (out.id [n] != NULL) {
+      out.id [n][index] = present ? getID (p) : 0;
+    }
+
+    if (out.area [n] != NULL) {
+      out.area [n][index] = present ? getArea (p) : 0;
+    }
+  }
+
+  return touches;
+}
+
+//============================================================================================//
+/**
+  @brief  Decodes complete frames packed back to back, FT62XX_FRAME_LENGTH bytes each, as
+  decode() would. The buffers are copied into a local structure first, so that the stores
+  into the byte arrays do not force the compiler to reload the array pointers, and the
+  NULL checks are the same in every iteration, so they are predicted.
+
+  Splitting the work into one loop per field lets GCC vectorize the loops, but the 15-byte
+  stride of the frames has no vector load, and the emulated gathers made that version
+  slower on x86-64 than this single pass.
+
+  @param  frames The frames.
+  @param  count The number of frames.
+  @param  out The buffers, with room for count entries.
+*/
+void CSE_FT6206_Decoder:: decodeBatch (const uint8_t *frames, uint32_t count, const CSE_FT6206_PointArrays &out) {
+  const CSE_FT6206_PointArrays arrays = out;
+  const uint8_t *__restrict__ in = frames;
+
+  for (uint32_t f = 0; f < count; f++, in += FT62XX_FRAME_LENGTH) {
+    if (arrays.touches != NULL) {
+      arrays.touches [f] = getTouches (in);
+    }
+
+    if (arrays.gesture != NULL) {
+      arrays.gesture [f] = in [FT62XX_REG_GEST_ID];
+    }
+
+    for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+      const uint8_t *p = &in [FT62XX_REG_P1_XH + (n * 6)];
+
+      if (arrays.x [n] != NULL) {
+        arrays.x [n][f] = getX (p);
+      }
+
+      if (arrays.y [n] != NULL) {
+        arrays.y [n][f] = getY (p);
+      }
+
+      if (arrays.z [n] != NULL) {
+        arrays.z [n][f] = getWeight (p);
+      }
+
+      if (arrays.state [n] != NULL) {
+        arrays.state [n][f] = getState (p);
+      }
+
+      if (arrays.id [n] != NULL) {
+        arrays.id [n][f] = getID (p);
+      }
+
+      if (arrays.area [n] != NULL) {
+        arrays.area [n][f] = getArea (p);
+      }
+    }
+  }
+}
+
+//============================================================================================//
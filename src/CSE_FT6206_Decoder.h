@@ -0,0 +1,62 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Decoder.h
+  Description: Stateless decoder of raw touch frames for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_DECODER_H
+#define CSE_FT6206_DECODER_H
+
+#include "CSE_FT6206_Platform.h"
+
+//============================================================================================//
+/*!
+  @brief  Caller-supplied buffers that receive decoded points as a structure of arrays. The
+  fields of point n in frame f go to entry f of the arrays with index n, and the frame
+  fields to entry f of touches and gesture. Any array can be NULL to skip that field or
+  point.
+*/
+struct CSE_FT6206_PointArrays {
+  int16_t *x [FT6206_MAX_TOUCH_POINTS]; // Controller coordinates, before any rotation or calibration
+  int16_t *y [FT6206_MAX_TOUCH_POINTS];
+  int16_t *z [FT6206_MAX_TOUCH_POINTS]; // Weight
+  uint8_t *state [FT6206_MAX_TOUCH_POINTS]; // FT62XX_TOUCH_*
+  uint8_t *id [FT6206_MAX_TOUCH_POINTS];
+  uint8_t *area [FT6206_MAX_TOUCH_POINTS];
+  uint8_t *touches; // 0 for an invalid count
+  uint8_t *gesture;
+};
+
+//============================================================================================//
+/*!
+  @brief  Unpacks the bits of the touch registers without any driver state. The field
+  functions are the single definition of the register layout and are used by CSE_FT6206 and
+  CSE_FT6206_Lite, and decode() and decodeBatch() apply them to caller buffers, so that
+  recorded frames can be decoded offline exactly as on the device.
+*/
+class CSE_FT6206_Decoder {
+  public:
+    // Fields of one point, from its 6 registers starting at XH.
+    static inline uint8_t getState (const uint8_t *p) { return p [0] >> 6; }
+    static inline uint8_t getID (const uint8_t *p) { return p [2] >> 4; }
+    static inline int16_t getX (const uint8_t *p) { return int16_t (((p [0] & 0x0F) << 8) | p [1]); }
+    static inline int16_t getY (const uint8_t *p) { return int16_t (((p [2] & 0x0F) << 8) | p [3]); }
+    static inline int16_t getWeight (const uint8_t *p) { return int16_t (p [4]); }
+    static inline uint8_t getArea (const uint8_t *p) { return p [5] >> 4; }
+    static inline uint8_t getTouches (const uint8_t *frame) { uint8_t n = frame [FT62XX_REG_TD_STATUS]; return (n > 2) ? 0 : n; }
+
+    static uint8_t decode (const uint8_t *frame, uint8_t length, const CSE_FT6206_PointArrays &out, uint32_t index = 0);
+    static void decodeBatch (const uint8_t *frames, uint32_t count, const CSE_FT6206_PointArrays &out);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_DECODER_H
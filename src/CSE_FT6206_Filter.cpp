@@ -0,0 +1,293 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Filter.cpp
+  Description: Per-finger coordinate filtering for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:06:12 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+// Metric statements compile to nothing unless CSE_FT6206_METRICS is defined.
+#ifdef CSE_FT6206_METRICS
+  #define FT6206_FILTER_METRIC(...)       __VA_ARGS__
+#else
+  #define FT6206_FILTER_METRIC(...)
+#endif
+
+#define FT6206_FILTER_ALPHA_BITS          12    // Fractional bits of the 1-Euro smoothing factors
+#define FT6206_FILTER_MAX_DT              65535 // Longest sample interval in microseconds used by the 1-Euro filter
+#define FT6206_FILTER_MAX_SPEED           32767 // Largest speed in pixels per second used by the 1-Euro filter
+#define FT6206_FILTER_RATE_MULTIPLIER     211   // 256 * 2^13 / 9947, converts (cutoff * dt) >> 13 to Q12 with >> 8
+#define FT6206_FILTER_SPEED_SCALE         16000000UL  // 2^8 * 10^6 / 2^4, 1/16 pixels per dt to pixels per second in Q8
+#define FT6206_FILTER_ALPHA_TABLE_FIRST   8     // log2 of the smallest rate in the smoothing factor table
+
+// Smoothing factors r / (r + 1) in Q12 at the rates r = 2^k and 1.5 * 2^k in Q12, for k from
+// FT6206_FILTER_ALPHA_TABLE_FIRST to 19, and at 2^20. Rates in between are interpolated.
+static const uint16_t alphaTable [] = {
+  241, 351, 455, 647, 819, 1117, 1365, 1755, 2048, 2458, 2731, 3072, 3277, 3511, 3641, 3781,
+  3855, 3932, 3972, 4012, 4033, 4054, 4064, 4075, 4080
+};
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new filter.
+
+  @param  mode One of FT6206_FILTER_*.
+*/
+CSE_FT6206_Filter:: CSE_FT6206_Filter (uint8_t mode) {
+  this->mode = mode;
+  setEmaAlpha();
+  setOneEuro();
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Forgets all fingers. The next sample of each finger passes through unchanged.
+*/
+void CSE_FT6206_Filter:: reset (void) {
+  FT6206_FILTER_METRIC (divisions = 0);
+
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    states [i].active = false;
+    states [i].id = 0;
+    states [i].timestamp = 0;
+    states [i].value [0] = 0;
+    states [i].value [1] = 0;
+    states [i].speed [0] = 0;
+    states [i].speed [1] = 0;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the filter mode and forgets all fingers.
+
+  @param  mode One of FT6206_FILTER_*.
+*/
+void CSE_FT6206_Filter:: setMode (uint8_t mode) {
+  this->mode = mode;
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the filter mode.
+*/
+uint8_t CSE_FT6206_Filter:: getMode (void) {
+  return mode;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the weight of a new sample in the EMA mode. Lower is smoother but lags more.
+
+  @param  alpha The weight in 1/256 (1 to 256).
+*/
+void CSE_FT6206_Filter:: setEmaAlpha (uint16_t alpha) {
+  emaAlpha = constrain (alpha, 1, 256);
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the parameters of the 1-Euro filter. Lower the minimum cutoff to reduce the
+  jitter at rest, and raise beta to reduce the lag when moving.
+
+  @param  minCutoff Cutoff frequency at rest in 1/256 Hz.
+  @param  beta Cutoff increase per pixel per second of speed, in 1/65536 Hz.
+  @param  derivativeCutoff Cutoff frequency of the speed estimate in 1/256 Hz.
+*/
+void CSE_FT6206_Filter:: setOneEuro (uint16_t minCutoff, uint16_t beta, uint16_t derivativeCutoff) {
+  this->minCutoff = (minCutoff == 0) ? 1 : minCutoff;
+  this->beta = beta;
+  this->derivativeCutoff = (derivativeCutoff == 0) ? 1 : derivativeCutoff;
+}
+
+//============================================================================================//
+/**
+  @brief  Filters the points of a frame in place. Points in contact are filtered. A lift-up
+  point gets the last filtered position so that it does not jump. A touch-down, or a new
+  hardware ID in a slot, resets the state of that finger.
+
+  @param  points The points of the frame.
+  @param  touches The number of touches in the frame.
+  @param  timestamp The micros() timestamp of the frame.
+*/
+void CSE_FT6206_Filter:: apply (CSE_TouchPoint *points, uint8_t touches, uint32_t timestamp) {
+  if (mode == FT6206_FILTER_NONE) {
+    return;
+  }
+
+  // The 1-Euro filter needs the reciprocal of the sample interval. The fingers of a frame
+  // share it, so it costs one division per frame.
+  uint32_t rateDt = 0;
+  uint32_t rate = 0;
+
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    CSE_TouchPoint &point = points [p];
+    CSE_FT6206_FilterState &state = states [p];
+    bool contact = (p < touches) && ((point.state == FT62XX_TOUCH_DOWN) || (point.state == FT62XX_TOUCH_CONTACT));
+
+    if (!contact) {
+      if ((point.state == FT62XX_TOUCH_UP) && state.active && (state.id == point.id) && (mode != FT6206_FILTER_MEDIAN3)) {
+        point.x = int16_t ((state.value [0] + (1 << (FT6206_FILTER_FRACTION_BITS - 1))) >> FT6206_FILTER_FRACTION_BITS);
+        point.y = int16_t ((state.value [1] + (1 << (FT6206_FILTER_FRACTION_BITS - 1))) >> FT6206_FILTER_FRACTION_BITS);
+      }
+
+      state.active = false;
+      continue;
+    }
+
+    if ((!state.active) || (point.state == FT62XX_TOUCH_DOWN) || (state.id != point.id)) {
+      const int16_t samples [2] = { point.x, point.y };
+
+      for (uint8_t axis = 0; axis < 2; axis++) {
+        state.history [axis][0] = samples [axis];
+        state.history [axis][1] = samples [axis];
+        state.history [axis][2] = samples [axis];
+        state.value [axis] = int32_t (samples [axis]) << FT6206_FILTER_FRACTION_BITS;
+        state.speed [axis] = 0;
+      }
+
+      state.active = true;
+      state.id = point.id;
+      state.timestamp = timestamp;
+      continue;
+    }
+
+    uint32_t dt = timestamp - state.timestamp;
+    dt = (dt == 0) ? 1 : ((dt > FT6206_FILTER_MAX_DT) ? FT6206_FILTER_MAX_DT : dt);
+    state.timestamp = timestamp;
+
+    if ((mode == FT6206_FILTER_ONE_EURO) && (dt != rateDt)) {
+      rate = FT6206_FILTER_SPEED_SCALE / dt;
+      rateDt = dt;
+      FT6206_FILTER_METRIC (divisions++);
+    }
+
+    point.x = filterAxis (state, 0, point.x, dt, rate);
+    point.y = filterAxis (state, 1, point.y, dt, rate);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Filters one axis of a finger.
+
+  @param  state The finger state.
+  @param  axis 0 for X and 1 for Y.
+  @param  sample The new raw sample.
+  @param  dt Time since the previous sample in microseconds.
+  @param  rate FT6206_FILTER_SPEED_SCALE / dt, used by the 1-Euro filter.
+
+  @returns The filtered position in pixels.
+*/
+int16_t CSE_FT6206_Filter:: filterAxis (CSE_FT6206_FilterState &state, uint8_t axis, int16_t sample, uint32_t dt, uint32_t rate) {
+  int32_t target = int32_t (sample) << FT6206_FILTER_FRACTION_BITS;
+  int32_t &value = state.value [axis];
+
+  switch (mode) {
+    case FT6206_FILTER_MEDIAN3: {
+      int16_t *history = state.history [axis];
+      history [0] = history [1];
+      history [1] = history [2];
+      history [2] = sample;
+      return median3 (history [0], history [1], history [2]);
+    }
+
+    case FT6206_FILTER_EMA:
+      value += ((target - value) * int32_t (emaAlpha)) >> 8;
+      break;
+
+    case FT6206_FILTER_ONE_EURO: {
+      // Estimate the speed in pixels per second and low-pass it. The rate is at most 2^24, so
+      // it is split into its integer and fraction parts to keep the products in 32 bits.
+      int32_t delta = constrain (target - value, -32767, 32767);
+      int32_t rawSpeed = (delta * int32_t (rate >> 8)) + ((delta * int32_t (rate & 0xFF)) >> 8);
+      rawSpeed = constrain (rawSpeed, -FT6206_FILTER_MAX_SPEED, FT6206_FILTER_MAX_SPEED);
+
+      int32_t &speed = state.speed [axis];
+      speed += ((rawSpeed - speed) * int32_t (smoothingFactor (derivativeCutoff, dt))) >> FT6206_FILTER_ALPHA_BITS;
+
+      // Raise the cutoff with the speed.
+      uint32_t cutoff = minCutoff + ((uint32_t (beta) * uint32_t (abs (speed))) >> 8);
+      cutoff = (cutoff > 0xFFFF) ? 0xFFFF : cutoff;
+
+      value += ((target - value) * int32_t (smoothingFactor (cutoff, dt))) >> FT6206_FILTER_ALPHA_BITS;
+      break;
+    }
+
+    default:
+      return sample;
+  }
+
+  return int16_t ((value + (1 << (FT6206_FILTER_FRACTION_BITS - 1))) >> FT6206_FILTER_FRACTION_BITS);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the smoothing factor of a first order low-pass filter, in Q12.
+  alpha = r / (r + 1), where r = 2 * pi * cutoff * dt. Nothing is divided at runtime, for
+  the cores without a hardware divider: small rates use r - r^2, and larger ones are
+  interpolated from a table with two points per octave, within 0.7% of the exact value.
+
+  @param  cutoff The cutoff frequency in 1/256 Hz, at most 0xFFFF.
+  @param  dt The sample interval in microseconds, at most FT6206_FILTER_MAX_DT.
+*/
+uint32_t CSE_FT6206_Filter:: smoothingFactor (uint32_t cutoff, uint32_t dt) {
+  uint32_t r = (((cutoff * dt) >> 13) * FT6206_FILTER_RATE_MULTIPLIER) >> 8; // Q12
+  r = (r > (uint32_t (1) << 19)) ? (uint32_t (1) << 19) : r;
+
+  if (r < (uint32_t (1) << FT6206_FILTER_ALPHA_TABLE_FIRST)) {
+    return r - ((r * r) >> FT6206_FILTER_ALPHA_BITS);
+  }
+
+  uint8_t k = FT6206_FILTER_ALPHA_TABLE_FIRST;
+
+  while ((r >> (k + 1)) != 0) {
+    k++;
+  }
+
+  uint8_t half = (r >> (k - 1)) & 1;
+  uint8_t i = ((k - FT6206_FILTER_ALPHA_TABLE_FIRST) * 2) + half;
+  uint32_t start = (uint32_t (2 + half)) << (k - 1);
+
+  return alphaTable [i] + (((uint32_t (alphaTable [i + 1] - alphaTable [i])) * (r - start)) >> (k - 1));
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of runtime divisions made by the filter, at most one per frame.
+*/
+#ifdef CSE_FT6206_METRICS
+  uint32_t CSE_FT6206_Filter:: getDivisionCount (void) {
+    return divisions;
+  }
+#endif
+
+//============================================================================================//
+/**
+  @brief  Returns the median of three values.
+*/
+int16_t CSE_FT6206_Filter:: median3 (int16_t a, int16_t b, int16_t c) {
+  if (a > b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+  }
+
+  if (b > c) {
+    b = c;
+  }
+
+  return (a > b) ? a : b;
+}
+
+//============================================================================================//
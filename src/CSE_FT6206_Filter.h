@@ -0,0 +1,93 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Filter.h
+  Description: Per-finger coordinate filtering for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_FILTER_H
+#define CSE_FT6206_FILTER_H
+
+#include "CSE_FT6206_Platform.h"
+#include "CSE_FT6206_FrameQueue.h"
+
+// Filter modes
+#define FT6206_FILTER_NONE                0x00  // Points pass through unchanged
+#define FT6206_FILTER_MEDIAN3             0x01  // Median of the last 3 samples
+#define FT6206_FILTER_EMA                 0x02  // Exponential moving average
+#define FT6206_FILTER_ONE_EURO            0x03  // Speed-adaptive low-pass filter
+
+#define FT6206_FILTER_FRACTION_BITS       4   // Sub-pixel bits of the filtered positions
+
+// Default parameters
+#define FT6206_DEFAULT_EMA_ALPHA          96    // Weight of a new sample in 1/256 (0.375)
+#define FT6206_DEFAULT_MIN_CUTOFF         256   // 1-Euro minimum cutoff in 1/256 Hz (1.0 Hz)
+#define FT6206_DEFAULT_BETA               3277  // 1-Euro speed coefficient in 1/65536 (0.05)
+#define FT6206_DEFAULT_DERIVATIVE_CUTOFF  256   // 1-Euro speed cutoff in 1/256 Hz (1.0 Hz)
+
+//============================================================================================//
+/*!
+  @brief  Filter state of one finger. Positions are in 1/16 pixels and speeds are in
+  pixels per second.
+*/
+struct CSE_FT6206_FilterState {
+  bool active;
+  uint8_t id; // Hardware ID nibble of the finger
+  uint32_t timestamp; // Timestamp of the last sample
+  int16_t history [2][3]; // Last 3 raw samples of each axis, for the median
+  int32_t value [2];  // Filtered position of each axis
+  int32_t speed [2];  // Filtered speed of each axis
+};
+
+//============================================================================================//
+/*!
+  @brief  Smooths the coordinates of each finger. The median removes single-sample spikes,
+  the EMA trades a fixed lag for smoothness, and the 1-Euro filter lowers its cutoff when
+  the finger rests and raises it when the finger moves, so that it is smooth at rest and
+  responsive when moving. All math is integer and the state of a finger is reset on
+  touch-down, so that the first sample passes through without lag.
+*/
+class CSE_FT6206_Filter {
+  public:
+    CSE_FT6206_Filter (uint8_t mode = FT6206_FILTER_ONE_EURO);
+
+    void apply (CSE_TouchPoint *points, uint8_t touches, uint32_t timestamp); // Filters the points in place
+    void reset (void);
+
+    void setMode (uint8_t mode);
+    uint8_t getMode (void);
+    void setEmaAlpha (uint16_t alpha = FT6206_DEFAULT_EMA_ALPHA);
+    void setOneEuro (uint16_t minCutoff = FT6206_DEFAULT_MIN_CUTOFF, uint16_t beta = FT6206_DEFAULT_BETA,
+      uint16_t derivativeCutoff = FT6206_DEFAULT_DERIVATIVE_CUTOFF);
+
+    #ifdef CSE_FT6206_METRICS
+      uint32_t getDivisionCount (void);  // Runtime divisions since reset()
+    #endif
+
+  private:
+    uint8_t mode;
+    uint16_t emaAlpha;
+    uint16_t minCutoff;
+    uint16_t beta;
+    uint16_t derivativeCutoff;
+    CSE_FT6206_FilterState states [FT6206_MAX_TOUCH_POINTS];
+
+    #ifdef CSE_FT6206_METRICS
+      uint32_t divisions;
+    #endif
+
+    int16_t filterAxis (CSE_FT6206_FilterState &state, uint8_t axis, int16_t sample, uint32_t dt, uint32_t rate);
+    static int16_t median3 (int16_t a, int16_t b, int16_t c);
+    static uint32_t smoothingFactor (uint32_t cutoff, uint32_t dt);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_FILTER_H
@@ -0,0 +1,156 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_FrameQueue.cpp
+  Description: Lock-free single-producer/single-consumer queue of decoded touch frames for
+  the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 11:20:36 AM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206_FrameQueue.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new frame queue.
+
+  @param  buffer Storage for the frames.
+  @param  capacity Number of frames in the buffer. The queue holds up to capacity - 1.
+*/
+CSE_FT6206_FrameQueue:: CSE_FT6206_FrameQueue (CSE_FT6206_Frame *buffer, uint8_t capacity) {
+  this->buffer = buffer;
+  this->capacity = capacity;
+  head = 0;
+  tail = 0;
+  overflows = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds a frame to the queue. Must only be called from the producer. A frame that is
+  not a transition is dropped if only one slot is left, so that the last slot is always
+  available for a touch-down or lift-up.
+
+  @param  frame The frame to add.
+  @param  transition True if the frame carries a touch-down, lift-up or touch count change.
+
+  @returns True if the frame was added, false if it was dropped.
+*/
+bool CSE_FT6206_FrameQueue:: push (const CSE_FT6206_Frame &frame, bool transition) {
+  if ((buffer == NULL) || (capacity < 2)) {
+    overflows++;
+    return false;
+  }
+
+  uint8_t used = available();
+  uint8_t free = (capacity - 1) - used;
+
+  if ((free == 0) || ((free == 1) && (!transition) && (capacity > 2))) {
+    overflows++;
+    return false;
+  }
+
+  uint8_t next = head + 1;
+
+  if (next >= capacity) {
+    next = 0;
+  }
+
+  buffer [head] = frame;
+  FT6206_MEMORY_BARRIER();  // The frame must be written before it is published
+  head = next;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes the oldest frame from the queue. Must only be called from the consumer.
+
+  @param  frame The frame to copy the data to.
+
+  @returns True if a frame was removed, false if the queue was empty.
+*/
+bool CSE_FT6206_FrameQueue:: pop (CSE_FT6206_Frame &frame) {
+  if (!peek (frame)) {
+    return false;
+  }
+
+  uint8_t next = tail + 1;
+
+  if (next >= capacity) {
+    next = 0;
+  }
+
+  FT6206_MEMORY_BARRIER();  // The frame must be copied before the slot is released
+  tail = next;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Copies the oldest frame without removing it.
+
+  @returns True if a frame was copied, false if the queue was empty.
+*/
+bool CSE_FT6206_FrameQueue:: peek (CSE_FT6206_Frame &frame) {
+  if (head == tail) {
+    return false;
+  }
+
+  FT6206_MEMORY_BARRIER();  // The frame must be read after the head
+  frame = buffer [tail];
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes all frames. Must only be called from the consumer.
+*/
+void CSE_FT6206_FrameQueue:: clear (void) {
+  tail = head;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames in the queue.
+*/
+uint8_t CSE_FT6206_FrameQueue:: available (void) const {
+  uint8_t h = head;
+  uint8_t t = tail;
+
+  return (h >= t) ? (h - t) : (capacity - t + h);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the maximum number of frames the queue can hold.
+*/
+uint8_t CSE_FT6206_FrameQueue:: getCapacity (void) const {
+  return (capacity > 0) ? (capacity - 1) : 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames that were dropped because the queue was full.
+*/
+uint32_t CSE_FT6206_FrameQueue:: getOverflows (void) const {
+  return overflows;
+}
+
+//============================================================================================//
+/**
+  @brief  Resets the overflow counter.
+*/
+void CSE_FT6206_FrameQueue:: resetOverflows (void) {
+  overflows = 0;
+}
+
+//============================================================================================//
@@ -0,0 +1,86 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_FrameQueue.h
+  Description: Lock-free single-producer/single-consumer queue of decoded touch frames for
+  the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 01:14:22 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_FRAMEQUEUE_H
+#define CSE_FT6206_FRAMEQUEUE_H
+
+#include "CSE_FT6206_Platform.h"
+
+#ifndef FT6206_MAX_TOUCH_POINTS
+  #define FT6206_MAX_TOUCH_POINTS         2
+#endif
+
+// The producer and consumer can run on different cores on ESP32 and RP2040, so a full
+// barrier is needed there. A compiler barrier is enough on single core MCUs.
+#if defined (ARDUINO_ARCH_ESP32) || defined (ARDUINO_ARCH_RP2040) || defined (__linux__)
+  #define FT6206_MEMORY_BARRIER()         __sync_synchronize()
+#else
+  #define FT6206_MEMORY_BARRIER()         __asm__ __volatile__ ("" ::: "memory")
+#endif
+
+//============================================================================================//
+/*!
+  @brief  One decoded touch frame.
+*/
+struct CSE_FT6206_Frame {
+  uint32_t seq; // Frame sequence number
+  uint32_t timestamp; // micros() timestamp of the frame
+  uint8_t touches;  // Number of touches
+  uint8_t gestureID;  // Hardware gesture ID
+  uint8_t changed;  // Bit n is set if point n landed, moved or lifted in this frame
+  uint8_t lostEdges;  // INT edges before this frame that were not read, see CSE_FT6206::service()
+  uint8_t touchArea [FT6206_MAX_TOUCH_POINTS];
+  CSE_TouchPoint points [FT6206_MAX_TOUCH_POINTS];
+};
+
+//============================================================================================//
+/*!
+  @brief  Fixed-capacity single-producer/single-consumer ring buffer of touch frames. The
+  storage is supplied by the caller and one slot is always kept empty, so a buffer of N
+  frames holds up to N - 1 frames. The last free slot is reserved for frames that carry a
+  touch-down or lift-up, so that transitions are not lost when the consumer falls behind.
+*/
+class CSE_FT6206_FrameQueue {
+  public:
+    CSE_FT6206_FrameQueue (CSE_FT6206_Frame *buffer, uint8_t capacity);
+
+    // Producer side.
+
+    bool push (const CSE_FT6206_Frame &frame, bool transition = false);
+
+    // Consumer side.
+
+    bool pop (CSE_FT6206_Frame &frame); // Never blocks, returns false if empty
+    bool peek (CSE_FT6206_Frame &frame);
+    void clear (void);
+
+    // Status.
+
+    uint8_t available (void) const; // Number of frames in the queue
+    uint8_t getCapacity (void) const;
+    uint32_t getOverflows (void) const; // Number of frames dropped because the queue was full
+    void resetOverflows (void);
+
+  private:
+    CSE_FT6206_Frame *buffer;
+    uint8_t capacity;
+    volatile uint8_t head;  // Written by the producer only
+    volatile uint8_t tail;  // Written by the consumer only
+    volatile uint32_t overflows;  // Written by the producer only
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_FRAMEQUEUE_H
@@ -0,0 +1,474 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Gesture.cpp
+  Description: Software gesture recognition for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 03:05:47 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+#define FT6206_GESTURE_SCALE_ONE          65536 // Scale of 1.0 in Q16
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new gesture recognizer with the default thresholds.
+*/
+CSE_FT6206_Gesture:: CSE_FT6206_Gesture() {
+  callback = NULL;
+  setTapThresholds();
+  setDoubleTapInterval();
+  setLongPressTime();
+  setSwipeThresholds();
+  setPinchStep();
+  setRotateStep();
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Drops the gesture in progress, the pending tap and all buffered events.
+*/
+void CSE_FT6206_Gesture:: reset (void) {
+  active = false;
+  multi = false;
+  moved = false;
+  longPressed = false;
+  downTime = 0;
+  downX = 0;
+  downY = 0;
+  lastX = 0;
+  lastY = 0;
+
+  pinching = false;
+  startDistance = 0;
+  startAngle = 0;
+  lastScale = FT6206_GESTURE_SCALE_ONE;
+  lastAngle = 0;
+
+  tapPending = false;
+  tapTimestamp = 0;
+  tapX = 0;
+  tapY = 0;
+
+  eventHead = 0;
+  eventCount = 0;
+  droppedEvents = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Advances the recognizer by one frame.
+
+  @param  frame The decoded frame.
+*/
+void CSE_FT6206_Gesture:: update (const CSE_FT6206_Frame &frame) {
+  const CSE_TouchPoint *contacts [FT6206_MAX_TOUCH_POINTS];
+  uint8_t count = 0;
+
+  for (uint8_t p = 0; (p < frame.touches) && (p < FT6206_MAX_TOUCH_POINTS); p++) {
+    uint8_t state = frame.points [p].state;
+
+    if ((state == FT62XX_TOUCH_DOWN) || (state == FT62XX_TOUCH_CONTACT)) {
+      contacts [count++] = &frame.points [p];
+    }
+  }
+
+  if (count == 0) {
+    if (active) {
+      endTouch (frame.timestamp);
+    }
+    return;
+  }
+
+  if (!active) {
+    active = true;
+    multi = false;
+    moved = false;
+    longPressed = false;
+    downTime = frame.timestamp;
+    downX = contacts [0]->x;
+    downY = contacts [0]->y;
+    lastX = downX;
+    lastY = downY;
+  }
+
+  if (count >= 2) {
+    multi = true;
+
+    // Order the fingers by hardware ID so that the angle does not flip when the
+    // controller reports them in the other register slot.
+    if (contacts [0]->id <= contacts [1]->id) {
+      updatePair (*contacts [0], *contacts [1], frame.timestamp);
+    }
+    else {
+      updatePair (*contacts [1], *contacts [0], frame.timestamp);
+    }
+    return;
+  }
+
+  pinching = false;
+
+  if (!multi) {
+    updateSingle (*contacts [0], frame.timestamp);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Tracks a single finger for taps, long-presses and swipes.
+*/
+void CSE_FT6206_Gesture:: updateSingle (const CSE_TouchPoint &point, uint32_t timestamp) {
+  int32_t dx = int32_t (point.x) - downX;
+  int32_t dy = int32_t (point.y) - downY;
+
+  lastX = point.x;
+  lastY = point.y;
+
+  if (uint32_t ((dx * dx) + (dy * dy)) > (uint32_t (tapSlop) * tapSlop)) {
+    moved = true;
+  }
+
+  if ((!moved) && (!longPressed) && ((timestamp - downTime) >= longPressTime)) {
+    longPressed = true;
+    emit (newEvent (FT6206_GESTURE_LONG_PRESS, lastX, lastY, timestamp));
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Tracks two fingers for pinch and rotate. The first frame with two fingers sets
+  the reference distance and angle.
+*/
+void CSE_FT6206_Gesture:: updatePair (const CSE_TouchPoint &p1, const CSE_TouchPoint &p2, uint32_t timestamp) {
+  int32_t dx = int32_t (p2.x) - p1.x;
+  int32_t dy = int32_t (p2.y) - p1.y;
+  uint16_t distance = isqrt (uint32_t ((dx * dx) + (dy * dy)));
+  int16_t angle = atan2Centi (dy, dx);
+  int16_t cx = int16_t ((int32_t (p1.x) + p2.x) / 2);
+  int16_t cy = int16_t ((int32_t (p1.y) + p2.y) / 2);
+
+  if (!pinching) {
+    pinching = true;
+    startDistance = (distance == 0) ? 1 : distance;
+    startAngle = angle;
+    lastScale = FT6206_GESTURE_SCALE_ONE;
+    lastAngle = 0;
+    return;
+  }
+
+  int32_t scale = int32_t ((uint32_t (distance) << 16) / startDistance);
+  int32_t rotation = int32_t (angle) - startAngle;
+
+  if (rotation > 18000) {
+    rotation -= 36000;
+  }
+  else if (rotation < -18000) {
+    rotation += 36000;
+  }
+
+  if (abs (scale - lastScale) >= pinchStep) {
+    lastScale = scale;
+    emit (newEvent (FT6206_GESTURE_PINCH, cx, cy, timestamp));
+  }
+
+  if (abs (rotation - lastAngle) >= rotateStep) {
+    lastAngle = int16_t (rotation);
+    emit (newEvent (FT6206_GESTURE_ROTATE, cx, cy, timestamp));
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Classifies a single-finger touch as a swipe, tap or double-tap when it lifts.
+*/
+void CSE_FT6206_Gesture:: endTouch (uint32_t timestamp) {
+  active = false;
+  pinching = false;
+
+  if (multi || longPressed) {
+    return;
+  }
+
+  uint32_t duration = timestamp - downTime;
+  int32_t dx = int32_t (lastX) - downX;
+  int32_t dy = int32_t (lastY) - downY;
+  uint32_t travelSq = uint32_t ((dx * dx) + (dy * dy));
+
+  if ((travelSq >= (uint32_t (swipeDistance) * swipeDistance)) && (duration <= swipeTime)) {
+    uint32_t ms = (duration < 1000) ? 1 : (duration / 1000);
+    CSE_FT6206_GestureEvent event = newEvent (FT6206_GESTURE_SWIPE, lastX, lastY, timestamp);
+    event.vx = (dx * 1000) / int32_t (ms);
+    event.vy = (dy * 1000) / int32_t (ms);
+
+    if (abs (dx) >= abs (dy)) {
+      event.direction = (dx > 0) ? FT6206_SWIPE_RIGHT : FT6206_SWIPE_LEFT;
+    }
+    else {
+      event.direction = (dy > 0) ? FT6206_SWIPE_DOWN : FT6206_SWIPE_UP;
+    }
+
+    tapPending = false;
+    emit (event);
+    return;
+  }
+
+  if (moved || (duration > tapTime)) {
+    tapPending = false;
+    return;
+  }
+
+  // A tap that lands soon after and close to the previous one completes a double-tap.
+  int32_t tx = int32_t (downX) - tapX;
+  int32_t ty = int32_t (downY) - tapY;
+  uint32_t doubleSlop = uint32_t (tapSlop) * 2;
+
+  if (tapPending && ((downTime - tapTimestamp) <= doubleTapTime) &&
+      (uint32_t ((tx * tx) + (ty * ty)) <= (doubleSlop * doubleSlop))) {
+    tapPending = false;
+    emit (newEvent (FT6206_GESTURE_DOUBLE_TAP, downX, downY, timestamp));
+    return;
+  }
+
+  tapPending = true;
+  tapTimestamp = timestamp;
+  tapX = downX;
+  tapY = downY;
+  emit (newEvent (FT6206_GESTURE_TAP, downX, downY, timestamp));
+}
+
+//============================================================================================//
+/**
+  @brief  Sets a function to receive the gestures. Pass NULL to use the queue.
+
+  @param  callback The gesture callback.
+*/
+void CSE_FT6206_Gesture:: setCallback (CSE_FT6206_GestureCallback callback) {
+  this->callback = callback;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes the oldest gesture event from the queue.
+
+  @param  event The event to copy the data to.
+
+  @returns True if an event was removed, false if the queue was empty.
+*/
+bool CSE_FT6206_Gesture:: popEvent (CSE_FT6206_GestureEvent &event) {
+  if (eventCount == 0) {
+    return false;
+  }
+
+  uint8_t tail = (eventHead + FT6206_GESTURE_QUEUE_SIZE - eventCount) % FT6206_GESTURE_QUEUE_SIZE;
+  event = events [tail];
+  eventCount--;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of gesture events in the queue.
+*/
+uint8_t CSE_FT6206_Gesture:: availableEvents (void) {
+  return eventCount;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of gesture events dropped because the queue was full.
+*/
+uint32_t CSE_FT6206_Gesture:: getDroppedEvents (void) {
+  return droppedEvents;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the longest duration and largest movement of a tap.
+
+  @param  timeMs The longest touch in milliseconds.
+  @param  slop The movement in pixels.
+*/
+void CSE_FT6206_Gesture:: setTapThresholds (uint16_t timeMs, uint16_t slop) {
+  tapTime = uint32_t (timeMs) * 1000;
+  tapSlop = slop;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the longest time between the lift of a tap and the touch-down of the next
+  one for a double-tap.
+
+  @param  timeMs The interval in milliseconds.
+*/
+void CSE_FT6206_Gesture:: setDoubleTapInterval (uint16_t timeMs) {
+  doubleTapTime = uint32_t (timeMs) * 1000;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how long a finger has to rest for a long-press.
+
+  @param  timeMs The hold time in milliseconds.
+*/
+void CSE_FT6206_Gesture:: setLongPressTime (uint16_t timeMs) {
+  longPressTime = uint32_t (timeMs) * 1000;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the minimum travel and the longest duration of a swipe.
+
+  @param  distance The travel in pixels.
+  @param  timeMs The longest stroke in milliseconds.
+*/
+void CSE_FT6206_Gesture:: setSwipeThresholds (uint16_t distance, uint16_t timeMs) {
+  swipeDistance = distance;
+  swipeTime = uint32_t (timeMs) * 1000;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the scale change since the last pinch event that emits a new one.
+
+  @param  step The scale change in Q16.
+*/
+void CSE_FT6206_Gesture:: setPinchStep (int32_t step) {
+  pinchStep = (step <= 0) ? 1 : step;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the angle change since the last rotate event that emits a new one.
+
+  @param  step The angle change in 1/100 degrees.
+*/
+void CSE_FT6206_Gesture:: setRotateStep (int16_t step) {
+  rotateStep = (step <= 0) ? 1 : step;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the name of a gesture event type.
+*/
+const char *CSE_FT6206_Gesture:: getName (uint8_t type) {
+  switch (type) {
+    case FT6206_GESTURE_TAP:
+      return "Tap";
+    case FT6206_GESTURE_DOUBLE_TAP:
+      return "Double Tap";
+    case FT6206_GESTURE_LONG_PRESS:
+      return "Long Press";
+    case FT6206_GESTURE_SWIPE:
+      return "Swipe";
+    case FT6206_GESTURE_PINCH:
+      return "Pinch";
+    case FT6206_GESTURE_ROTATE:
+      return "Rotate";
+    default:
+      return "None";
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns an event with the current pinch scale and angle, and no velocity.
+*/
+CSE_FT6206_GestureEvent CSE_FT6206_Gesture:: newEvent (uint8_t type, int16_t x, int16_t y, uint32_t timestamp) {
+  CSE_FT6206_GestureEvent event;
+  event.type = type;
+  event.direction = FT6206_SWIPE_NONE;
+  event.x = x;
+  event.y = y;
+  event.vx = 0;
+  event.vy = 0;
+  event.scale = pinching ? lastScale : FT6206_GESTURE_SCALE_ONE;
+  event.angle = pinching ? lastAngle : 0;
+  event.timestamp = timestamp;
+
+  return event;
+}
+
+//============================================================================================//
+/**
+  @brief  Delivers an event to the callback, or adds it to the queue.
+*/
+void CSE_FT6206_Gesture:: emit (const CSE_FT6206_GestureEvent &event) {
+  if (callback != NULL) {
+    callback (event);
+    return;
+  }
+
+  if (eventCount >= FT6206_GESTURE_QUEUE_SIZE) {
+    eventCount--; // Drop the oldest event
+    droppedEvents++;
+  }
+
+  events [eventHead] = event;
+  eventHead = (eventHead + 1) % FT6206_GESTURE_QUEUE_SIZE;
+  eventCount++;
+}
+
+//============================================================================================//
+/**
+  @brief  Integer square root.
+*/
+uint16_t CSE_FT6206_Gesture:: isqrt (uint32_t value) {
+  uint32_t result = 0;
+  uint32_t bit = uint32_t (1) << 30;
+
+  while (bit > value) {
+    bit >>= 2;
+  }
+
+  while (bit != 0) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return uint16_t (result);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the angle of a vector in 1/100 degrees (-18000 to 18000). Uses the
+  approximation atan (t) = t * 45 + 15.64 * t * (1 - t) degrees for t in [0, 1], which is
+  within 0.25 degrees.
+*/
+int16_t CSE_FT6206_Gesture:: atan2Centi (int32_t y, int32_t x) {
+  int32_t ax = abs (x);
+  int32_t ay = abs (y);
+
+  if ((ax == 0) && (ay == 0)) {
+    return 0;
+  }
+
+  bool steep = ay > ax;
+  int32_t t = steep ? ((ax << 15) / ay) : ((ay << 15) / ax); // Q15, 0 to 1
+  int32_t angle = ((t * 4500) >> 15) + ((((t * (32768 - t)) >> 15) * 1564) >> 15);
+
+  if (steep) {
+    angle = 9000 - angle;
+  }
+
+  if (x < 0) {
+    angle = 18000 - angle;
+  }
+
+  return int16_t ((y < 0) ? -angle : angle);
+}
+
+//============================================================================================//
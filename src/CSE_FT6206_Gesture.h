@@ -0,0 +1,143 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Gesture.h
+  Description: Software gesture recognition for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_GESTURE_H
+#define CSE_FT6206_GESTURE_H
+
+#include "CSE_FT6206_Platform.h"
+#include "CSE_FT6206_FrameQueue.h"
+
+#define FT6206_GESTURE_QUEUE_SIZE         4 // Number of gesture events buffered by the recognizer
+
+// Gesture event types
+#define FT6206_GESTURE_TAP                0x00  // A short touch without movement
+#define FT6206_GESTURE_DOUBLE_TAP         0x01  // A second tap close to the first one
+#define FT6206_GESTURE_LONG_PRESS         0x02  // A touch held without movement
+#define FT6206_GESTURE_SWIPE              0x03  // A fast single-finger stroke
+#define FT6206_GESTURE_PINCH              0x04  // The distance between two fingers changed
+#define FT6206_GESTURE_ROTATE             0x05  // The angle between two fingers changed
+
+// Swipe directions
+#define FT6206_SWIPE_NONE                 0x00
+#define FT6206_SWIPE_UP                   0x01
+#define FT6206_SWIPE_RIGHT                0x02
+#define FT6206_SWIPE_DOWN                 0x03
+#define FT6206_SWIPE_LEFT                 0x04
+
+// Default thresholds
+#define FT6206_DEFAULT_TAP_TIME_MS        250   // Longest touch that is still a tap
+#define FT6206_DEFAULT_TAP_SLOP           12    // Movement in pixels beyond which a touch is not a tap
+#define FT6206_DEFAULT_DOUBLE_TAP_MS      300   // Longest time between the two taps of a double-tap
+#define FT6206_DEFAULT_LONG_PRESS_MS      600   // Hold time of a long-press
+#define FT6206_DEFAULT_SWIPE_DISTANCE     40    // Minimum travel in pixels of a swipe
+#define FT6206_DEFAULT_SWIPE_TIME_MS      500   // Longest stroke that is still a swipe
+#define FT6206_DEFAULT_PINCH_STEP         3277  // Minimum scale change for a pinch event (0.05 in Q16)
+#define FT6206_DEFAULT_ROTATE_STEP        500   // Minimum angle change for a rotate event in 1/100 degrees
+
+//============================================================================================//
+/*!
+  @brief  A recognized gesture. The scale is the distance between the two fingers relative
+  to when the second finger landed, in Q16 (65536 is 1.0). The angle is the rotation since
+  then in 1/100 degrees, positive from the X axis towards the Y axis.
+*/
+struct CSE_FT6206_GestureEvent {
+  uint8_t type; // One of FT6206_GESTURE_*
+  uint8_t direction;  // One of FT6206_SWIPE_* for swipes
+  int16_t x;  // Position of the touch, or the center of the two fingers
+  int16_t y;
+  int32_t vx; // Swipe velocity in pixels per second
+  int32_t vy;
+  int32_t scale;  // Pinch scale in Q16
+  int16_t angle;  // Rotation in 1/100 degrees
+  uint32_t timestamp; // micros() timestamp of the frame
+};
+
+typedef void (*CSE_FT6206_GestureCallback) (const CSE_FT6206_GestureEvent &event);
+
+//============================================================================================//
+/*!
+  @brief  Recognizes tap, double-tap, long-press, swipe, pinch and rotate gestures from the
+  decoded frames. Each frame is processed in constant time and no memory is allocated.
+  Gestures are only recognized when frames arrive, so a long-press is reported on the first
+  frame after the hold time. A touch that had two fingers down at any time never becomes a
+  tap or swipe. Events go to the callback if one is set, otherwise to an internal queue.
+*/
+class CSE_FT6206_Gesture {
+  public:
+    CSE_FT6206_Gesture();
+
+    void update (const CSE_FT6206_Frame &frame);  // Consumes a decoded frame
+    void reset (void);  // Drops the gesture in progress and the buffered events
+
+    void setCallback (CSE_FT6206_GestureCallback callback);
+    bool popEvent (CSE_FT6206_GestureEvent &event); // Never blocks, returns false if empty
+    uint8_t availableEvents (void);
+    uint32_t getDroppedEvents (void);
+
+    void setTapThresholds (uint16_t timeMs = FT6206_DEFAULT_TAP_TIME_MS, uint16_t slop = FT6206_DEFAULT_TAP_SLOP);
+    void setDoubleTapInterval (uint16_t timeMs = FT6206_DEFAULT_DOUBLE_TAP_MS);
+    void setLongPressTime (uint16_t timeMs = FT6206_DEFAULT_LONG_PRESS_MS);
+    void setSwipeThresholds (uint16_t distance = FT6206_DEFAULT_SWIPE_DISTANCE, uint16_t timeMs = FT6206_DEFAULT_SWIPE_TIME_MS);
+    void setPinchStep (int32_t step = FT6206_DEFAULT_PINCH_STEP);
+    void setRotateStep (int16_t step = FT6206_DEFAULT_ROTATE_STEP);
+
+    static const char *getName (uint8_t type);
+
+  private:
+    // Thresholds
+    uint32_t tapTime, doubleTapTime, longPressTime, swipeTime; // In microseconds
+    uint16_t tapSlop;
+    uint16_t swipeDistance;
+    int32_t pinchStep;
+    int16_t rotateStep;
+
+    // Touch in progress
+    bool active;  // At least one finger is down
+    bool multi; // A second finger landed during this touch
+    bool moved; // The touch left the tap slop
+    bool longPressed; // A long-press was reported for this touch
+    uint32_t downTime;
+    int16_t downX, downY;
+    int16_t lastX, lastY;
+
+    // Two-finger state
+    bool pinching;
+    uint16_t startDistance;
+    int16_t startAngle;
+    int32_t lastScale;
+    int16_t lastAngle;
+
+    // Last tap, for double-tap
+    bool tapPending;
+    uint32_t tapTimestamp;
+    int16_t tapX, tapY;
+
+    CSE_FT6206_GestureCallback callback;
+    CSE_FT6206_GestureEvent events [FT6206_GESTURE_QUEUE_SIZE];
+    uint8_t eventHead;
+    uint8_t eventCount;
+    uint32_t droppedEvents;
+
+    void updateSingle (const CSE_TouchPoint &point, uint32_t timestamp);
+    void updatePair (const CSE_TouchPoint &p1, const CSE_TouchPoint &p2, uint32_t timestamp);
+    void endTouch (uint32_t timestamp);
+    CSE_FT6206_GestureEvent newEvent (uint8_t type, int16_t x, int16_t y, uint32_t timestamp);
+    void emit (const CSE_FT6206_GestureEvent &event);
+    static uint16_t isqrt (uint32_t value);
+    static int16_t atan2Centi (int32_t y, int32_t x);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_GESTURE_H
@@ -0,0 +1,297 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_HitTest.cpp
+  Description: Grid index that maps touch points to UI targets for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:10:26 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates an empty index.
+
+  @param  width The width of the display in its current rotation.
+  @param  height The height of the display in its current rotation.
+*/
+CSE_FT6206_HitTest:: CSE_FT6206_HitTest (uint16_t width, uint16_t height) {
+  this->width = 0;
+  this->height = 0;
+  clear();
+  setBounds (width, height);
+
+  for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+    hits [n] = FT6206_HIT_NONE;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Adds a target. Targets on a higher layer are on top, and within a layer the
+  target added last is on top.
+
+  @param  id The application ID of the target, not FT6206_HIT_NONE.
+  @param  rect The area of the target in display coordinates, inclusive.
+  @param  layer The layer.
+
+  @returns True if the target was added, false if the index is full, the ID is already
+  used or the rectangle is empty.
+*/
+bool CSE_FT6206_HitTest:: add (uint8_t id, const CSE_FT6206_Rect &rect, uint8_t layer) {
+  if ((id == FT6206_HIT_NONE) || (rect.x2 < rect.x1) || (rect.y2 < rect.y1) || (findSlot (id) >= 0)) {
+    return false;
+  }
+
+  for (uint8_t slot = 0; slot < FT6206_HIT_MAX_TARGETS; slot++) {
+    CSE_FT6206_HitTarget &target = targets [slot];
+
+    if (target.id != FT6206_HIT_NONE) {
+      continue;
+    }
+
+    target.rect = rect;
+    target.id = id;
+    target.layer = layer;
+    target.order = nextOrder++;
+    count++;
+    mark (slot, true);
+    return true;
+  }
+
+  return false;
+}
+
+//============================================================================================//
+/**
+  @brief  Changes the area of a target. It keeps its layer and its order.
+
+  @returns True if the target exists and the rectangle is not empty.
+*/
+bool CSE_FT6206_HitTest:: move (uint8_t id, const CSE_FT6206_Rect &rect) {
+  int8_t slot = findSlot (id);
+
+  if ((slot < 0) || (rect.x2 < rect.x1) || (rect.y2 < rect.y1)) {
+    return false;
+  }
+
+  mark (uint8_t (slot), false);
+  targets [slot].rect = rect;
+  mark (uint8_t (slot), true);
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes a target.
+
+  @returns True if the target existed.
+*/
+bool CSE_FT6206_HitTest:: remove (uint8_t id) {
+  int8_t slot = findSlot (id);
+
+  if (slot < 0) {
+    return false;
+  }
+
+  mark (uint8_t (slot), false);
+  targets [slot].id = FT6206_HIT_NONE;
+  count--;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes all targets.
+*/
+void CSE_FT6206_HitTest:: clear (void) {
+  for (uint8_t slot = 0; slot < FT6206_HIT_MAX_TARGETS; slot++) {
+    targets [slot].id = FT6206_HIT_NONE;
+  }
+
+  memset (cells, 0, sizeof (cells));
+  count = 0;
+  nextOrder = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of targets.
+*/
+uint8_t CSE_FT6206_HitTest:: getCount (void) {
+  return count;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the size of the display the grid covers. The cells are rebuilt if the size
+  changed, for example after a rotation.
+
+  @param  width The width of the display in its current rotation.
+  @param  height The height of the display in its current rotation.
+*/
+void CSE_FT6206_HitTest:: setBounds (uint16_t width, uint16_t height) {
+  if ((width == this->width) && (height == this->height)) {
+    return;
+  }
+
+  this->width = width;
+  this->height = height;
+  cellWidth = (width + FT6206_HIT_GRID_COLUMNS - 1) / FT6206_HIT_GRID_COLUMNS;
+  cellHeight = (height + FT6206_HIT_GRID_ROWS - 1) / FT6206_HIT_GRID_ROWS;
+  cellWidth = (cellWidth == 0) ? 1 : cellWidth;
+  cellHeight = (cellHeight == 0) ? 1 : cellHeight;
+  rebuild();
+}
+
+//============================================================================================//
+/**
+  @brief  Finds the topmost target at a point. Only the targets overlapping the cell of the
+  point are checked, so the cost is bounded by the targets in one cell.
+
+  @param  x The X coordinate in display coordinates.
+  @param  y The Y coordinate in display coordinates.
+
+  @returns The ID of the target, or FT6206_HIT_NONE.
+*/
+uint8_t CSE_FT6206_HitTest:: find (int16_t x, int16_t y) {
+  uint32_t candidates = cells [row (y)][column (x)];
+  int8_t best = -1;
+
+  for (uint8_t slot = 0; candidates != 0; slot++, candidates >>= 1) {
+    // Skip empty bytes of the mask at once.
+    while ((candidates & 0xFF) == 0) {
+      candidates >>= 8;
+      slot += 8;
+    }
+
+    if ((candidates & 1) == 0) {
+      continue;
+    }
+
+    const CSE_FT6206_HitTarget &target = targets [slot];
+
+    if ((x < target.rect.x1) || (x > target.rect.x2) || (y < target.rect.y1) || (y > target.rect.y2)) {
+      continue;
+    }
+
+    if ((best < 0) || (target.layer > targets [best].layer) ||
+        ((target.layer == targets [best].layer) && ((int16_t) (target.order - targets [best].order) > 0))) {
+      best = int8_t (slot);
+    }
+  }
+
+  return (best < 0) ? FT6206_HIT_NONE : targets [best].id;
+}
+
+//============================================================================================//
+/**
+  @brief  Resolves the points of a new frame. Called by the panel for every frame when the
+  index is attached with attachHitTest().
+
+  @param  points The points of the frame. Points in the FT62XX_TOUCH_NONE state have no
+  target.
+  @param  count The number of entries in points.
+  @param  width The width of the display in its current rotation.
+  @param  height The height of the display in its current rotation.
+*/
+void CSE_FT6206_HitTest:: update (const CSE_TouchPoint *points, uint8_t count, uint16_t width, uint16_t height) {
+  setBounds (width, height);
+
+  for (uint8_t n = 0; n < FT6206_MAX_TOUCH_POINTS; n++) {
+    bool present = (n < count) && (points [n].state != FT62XX_TOUCH_NONE);
+    hits [n] = present ? find (points [n].x, points [n].y) : FT6206_HIT_NONE;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the target under a point of the last frame, or FT6206_HIT_NONE. A point
+  that lifted up in the frame still reports the target it lifted from.
+
+  @param  n The index of the point.
+*/
+uint8_t CSE_FT6206_HitTest:: getHit (uint8_t n) {
+  return (n < FT6206_MAX_TOUCH_POINTS) ? hits [n] : FT6206_HIT_NONE;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the slot of a target, or -1 if the ID is not registered.
+*/
+int8_t CSE_FT6206_HitTest:: findSlot (uint8_t id) {
+  for (uint8_t slot = 0; slot < FT6206_HIT_MAX_TARGETS; slot++) {
+    if (targets [slot].id == id) {
+      return int8_t (slot);
+    }
+  }
+
+  return -1;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets or clears the bit of a target in the cells it overlaps.
+*/
+void CSE_FT6206_HitTest:: mark (uint8_t slot, bool set) {
+  const CSE_FT6206_Rect &rect = targets [slot].rect;
+  uint32_t bit = uint32_t (1) << slot;
+  uint8_t c1 = column (rect.x1), c2 = column (rect.x2);
+  uint8_t r1 = row (rect.y1), r2 = row (rect.y2);
+
+  for (uint8_t r = r1; r <= r2; r++) {
+    for (uint8_t c = c1; c <= c2; c++) {
+      cells [r][c] = set ? (cells [r][c] | bit) : (cells [r][c] & ~bit);
+    }
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the grid column of an X coordinate. Coordinates outside the display go
+  to the edge cells, so that a target or a point beyond the edge is still found.
+*/
+uint8_t CSE_FT6206_HitTest:: column (int16_t x) {
+  if (x < 0) {
+    return 0;
+  }
+
+  uint16_t c = uint16_t (x) / cellWidth;
+  return (c >= FT6206_HIT_GRID_COLUMNS) ? (FT6206_HIT_GRID_COLUMNS - 1) : uint8_t (c);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the grid row of a Y coordinate, like column().
+*/
+uint8_t CSE_FT6206_HitTest:: row (int16_t y) {
+  if (y < 0) {
+    return 0;
+  }
+
+  uint16_t r = uint16_t (y) / cellHeight;
+  return (r >= FT6206_HIT_GRID_ROWS) ? (FT6206_HIT_GRID_ROWS - 1) : uint8_t (r);
+}
+
+//============================================================================================//
+/**
+  @brief  Marks all targets again after the cell size changed.
+*/
+void CSE_FT6206_HitTest:: rebuild (void) {
+  memset (cells, 0, sizeof (cells));
+
+  for (uint8_t slot = 0; slot < FT6206_HIT_MAX_TARGETS; slot++) {
+    if (targets [slot].id != FT6206_HIT_NONE) {
+      mark (slot, true);
+    }
+  }
+}
+
+//============================================================================================//
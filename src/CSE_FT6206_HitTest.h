@@ -0,0 +1,81 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_HitTest.h
+  Description: Grid index that maps touch points to UI targets for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_HIT_TEST_H
+#define CSE_FT6206_HIT_TEST_H
+
+#include "CSE_FT6206_Platform.h"
+
+#define FT6206_HIT_MAX_TARGETS            32    // Targets one index can hold, one bit each in a cell
+#define FT6206_HIT_GRID_COLUMNS           8     // Grid cells across the display
+#define FT6206_HIT_GRID_ROWS              8     // Grid cells down the display
+#define FT6206_HIT_NONE                   0xFF  // No target at the point
+
+//============================================================================================//
+/*!
+  @brief  A registered target.
+*/
+struct CSE_FT6206_HitTarget {
+  CSE_FT6206_Rect rect; // Display coordinates, inclusive
+  uint8_t id; // Application ID, FT6206_HIT_NONE if the slot is free
+  uint8_t layer;  // Higher layers are on top
+  uint16_t order; // Insertion order, later targets are on top within a layer
+};
+
+//============================================================================================//
+/*!
+  @brief  Finds the topmost target under a point without scanning all targets. The display
+  is divided into a fixed grid, and every cell keeps a bit mask of the targets that overlap
+  it, so a lookup only checks the targets in one cell. Adding, moving or removing a target
+  only updates the cells it covers. The grid follows the width and height of the display,
+  which change with the rotation; it is rebuilt when they change.
+
+  Attach the index to a panel with attachHitTest() to resolve the points of every new frame,
+  and read the results with getHit().
+*/
+class CSE_FT6206_HitTest {
+  public:
+    CSE_FT6206_HitTest (uint16_t width, uint16_t height);
+
+    bool add (uint8_t id, const CSE_FT6206_Rect &rect, uint8_t layer = 0);  // False if full or the ID exists
+    bool move (uint8_t id, const CSE_FT6206_Rect &rect);
+    bool remove (uint8_t id);
+    void clear (void);
+    uint8_t getCount (void);
+
+    void setBounds (uint16_t width, uint16_t height); // Display size after rotation, rebuilds if changed
+    uint8_t find (int16_t x, int16_t y);  // Topmost target at a point, FT6206_HIT_NONE if none
+    void update (const CSE_TouchPoint *points, uint8_t count, uint16_t width, uint16_t height); // Called for every frame
+    uint8_t getHit (uint8_t n = 0); // Target under point n of the last frame
+
+  private:
+    CSE_FT6206_HitTarget targets [FT6206_HIT_MAX_TARGETS];
+    uint32_t cells [FT6206_HIT_GRID_ROWS][FT6206_HIT_GRID_COLUMNS];  // Bit n is set if target slot n overlaps the cell
+    uint8_t count;
+    uint16_t nextOrder;
+    uint16_t width, height;
+    uint16_t cellWidth, cellHeight;
+    uint8_t hits [FT6206_MAX_TOUCH_POINTS];
+
+    int8_t findSlot (uint8_t id);
+    void mark (uint8_t slot, bool set);
+    uint8_t column (int16_t x);
+    uint8_t row (int16_t y);
+    void rebuild (void);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_HIT_TEST_H
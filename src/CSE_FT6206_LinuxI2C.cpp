@@ -0,0 +1,213 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_LinuxI2C.cpp
+  Description: Linux i2c-dev transport for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+#if defined (__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+//============================================================================================//
+/**
+  @brief  Calls the real ioctl().
+*/
+static int systemIoctl (int fd, unsigned long request, void *argument) {
+  return ioctl (fd, request, argument);
+}
+
+//============================================================================================//
+/**
+  @brief  Instantiates a transport. Nothing is opened until begin().
+
+  @param  path The adapter device file, which must stay valid.
+  @param  ioctlFunction A stand-in for ioctl(), or NULL for the real one.
+*/
+CSE_FT6206_LinuxI2C:: CSE_FT6206_LinuxI2C (const char *path, CSE_FT6206_Ioctl ioctlFunction) {
+  this->path = path;
+  this->ioctlFunction = (ioctlFunction == NULL) ? systemIoctl : ioctlFunction;
+  fd = -1;
+  calls = 0;
+  lastErrno = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Closes the device file.
+*/
+CSE_FT6206_LinuxI2C:: ~CSE_FT6206_LinuxI2C() {
+  end();
+}
+
+//============================================================================================//
+/**
+  @brief  Opens the device file. Called by the driver at the start and after a bus
+  recovery, so an open file is kept.
+*/
+void CSE_FT6206_LinuxI2C:: begin (void) {
+  if (fd >= 0) {
+    return;
+  }
+
+  fd = open (path, O_RDWR);
+  lastErrno = (fd < 0) ? errno : 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Closes the device file.
+*/
+void CSE_FT6206_LinuxI2C:: end (void) {
+  if (fd >= 0) {
+    close (fd);
+    fd = -1;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if the device file is open.
+*/
+bool CSE_FT6206_LinuxI2C:: isOpen (void) {
+  return fd >= 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Does nothing. The clock of an adapter is set in the device tree.
+*/
+void CSE_FT6206_LinuxI2C:: setClock (uint32_t clock) {
+  (void) clock;
+}
+
+//============================================================================================//
+/**
+  @brief  Sends the address of a device with an empty write message.
+
+  @returns FT6206_I2C_OK if the device acknowledged, or the error.
+*/
+uint8_t CSE_FT6206_LinuxI2C:: probe (uint8_t address) {
+  struct i2c_msg message = { address, 0, 0, NULL };
+  return transfer (&message, 1);
+}
+
+//============================================================================================//
+/**
+  @brief  Reads consecutive registers with one I2C_RDWR call: a write of the register
+  address, then a repeated START and a read of the data.
+
+  @param  address The 7-bit device address.
+  @param  reg The first register.
+  @param  buffer Receives the values.
+  @param  length The number of registers.
+
+  @returns FT6206_I2C_OK, or the error.
+*/
+uint8_t CSE_FT6206_LinuxI2C:: readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) {
+  struct i2c_msg messages [2] = {
+    { address, 0, 1, &reg },
+    { address, I2C_M_RD, length, buffer }
+  };
+
+  return transfer (messages, 2);
+}
+
+//============================================================================================//
+/**
+  @brief  Writes consecutive registers with one I2C_RDWR call of one message.
+
+  @param  address The 7-bit device address.
+  @param  reg The first register.
+  @param  buffer The values.
+  @param  length The number of registers, up to FT6206_LINUX_MAX_WRITE.
+
+  @returns FT6206_I2C_OK, or the error. Longer writes are bus errors.
+*/
+uint8_t CSE_FT6206_LinuxI2C:: writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length) {
+  if (length > FT6206_LINUX_MAX_WRITE) {
+    return FT6206_I2C_BUS_ERROR;
+  }
+
+  uint8_t data [FT6206_LINUX_MAX_WRITE + 1];
+  data [0] = reg;
+
+  if (length > 0) {
+    memcpy (&data [1], buffer, length);
+  }
+
+  struct i2c_msg message = { address, 0, uint16_t (length + 1), data };
+  return transfer (&message, 1);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of system calls made for transfers.
+*/
+uint32_t CSE_FT6206_LinuxI2C:: getCallCount (void) {
+  return calls;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the errno of the last failed open or transfer, 0 if it succeeded.
+*/
+int CSE_FT6206_LinuxI2C:: getLastErrno (void) {
+  return lastErrno;
+}
+
+//============================================================================================//
+/**
+  @brief  Runs messages as one combined transfer. The adapter drivers report a NACK of the
+  address as ENXIO, and most report other NACKs as EREMOTEIO or EIO.
+
+  @param  messages The i2c_msg array.
+  @param  count The number of messages.
+
+  @returns FT6206_I2C_OK, or the error.
+*/
+uint8_t CSE_FT6206_LinuxI2C:: transfer (void *messages, uint8_t count) {
+  if (fd < 0) {
+    return FT6206_I2C_BUS_ERROR;
+  }
+
+  struct i2c_rdwr_ioctl_data data = { (struct i2c_msg *) messages, count };
+  calls++;
+
+  if (ioctlFunction (fd, I2C_RDWR, &data) == int (count)) {
+    lastErrno = 0;
+    return FT6206_I2C_OK;
+  }
+
+  lastErrno = errno;
+
+  switch (lastErrno) {
+    case ENXIO:
+      return FT6206_I2C_ADDRESS_NACK;
+
+    case EREMOTEIO:
+    case EIO:
+      return FT6206_I2C_DATA_NACK;
+
+    default:
+      return FT6206_I2C_BUS_ERROR;
+  }
+}
+
+#endif // __linux__
+
+//============================================================================================//
@@ -0,0 +1,71 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_LinuxI2C.h
+  Description: Linux i2c-dev transport for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 10:41:09 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_LINUX_I2C_H
+#define CSE_FT6206_LINUX_I2C_H
+
+#if defined (__linux__)
+
+#include "CSE_FT6206_Transport.h"
+
+#define FT6206_LINUX_MAX_WRITE            32  // Longest register write in bytes, without the register address
+
+//============================================================================================//
+/*!
+  @brief  The system call used to reach the adapter. It has the signature of ioctl(), so
+  that tests can replace the kernel with a stand-in.
+*/
+typedef int (*CSE_FT6206_Ioctl) (int fd, unsigned long request, void *argument);
+
+//============================================================================================//
+/*!
+  @brief  Transport over a Linux /dev/i2c-N adapter, for embedded Linux boards. Every
+  register read is a single I2C_RDWR ioctl with two messages, the register address and the
+  data, which the adapter joins with a repeated START. A port that selects the device with
+  I2C_SLAVE and then calls write() and read() needs two system calls and two STOPs for the
+  same read. Writes and probes are a single message each.
+
+  The device file is opened by begin() and closed by end() or the destructor.
+*/
+class CSE_FT6206_LinuxI2C : public CSE_FT6206_Transport {
+  public:
+    CSE_FT6206_LinuxI2C (const char *path = "/dev/i2c-1", CSE_FT6206_Ioctl ioctlFunction = NULL);
+    ~CSE_FT6206_LinuxI2C();
+
+    void begin (void);  // Opens the device file if it is not open
+    void end (void);
+    bool isOpen (void);
+    void setClock (uint32_t clock); // The clock is set by the kernel, ignored
+    uint8_t probe (uint8_t address);
+    uint8_t readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length);
+    uint8_t writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length);
+
+    uint32_t getCallCount (void); // System calls made for transfers
+    int getLastErrno (void);  // errno of the last failed call
+
+  private:
+    const char *path;
+    int fd; // -1 if closed
+    CSE_FT6206_Ioctl ioctlFunction;
+    uint32_t calls;
+    int lastErrno;
+
+    uint8_t transfer (void *messages, uint8_t count);
+};
+
+#endif // __linux__
+
+//============================================================================================//
+
+#endif // CSE_FT6206_LINUX_I2C_H
@@ -0,0 +1,259 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Lite.h
+  Description: Compile-time configured minimal driver for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 08:14:37 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_LITE_H
+#define CSE_FT6206_LITE_H
+
+#include "CSE_FT6206.h"
+
+// Optional features of CSE_FT6206_Lite
+#define FT6206_LITE_WEIGHT                0x01  // Decode the touch weight into z
+#define FT6206_LITE_AREA                  0x02  // Decode and store the touch area
+#define FT6206_LITE_GESTURE               0x04  // Store the gesture ID
+#define FT6206_LITE_ALL                   0x07
+
+//============================================================================================//
+/*!
+  @brief  Touch area storage of CSE_FT6206_Lite. Empty when the area is not used.
+*/
+template <uint8_t POINTS, bool ENABLED>
+class CSE_FT6206_LiteArea {
+  public:
+    uint8_t touchArea [POINTS];
+
+    uint8_t getArea (uint8_t n = 0) { return (n < POINTS) ? touchArea [n] : 0; }
+
+  protected:
+    void storeArea (uint8_t n, uint8_t area) { touchArea [n] = area; }
+};
+
+template <uint8_t POINTS>
+class CSE_FT6206_LiteArea <POINTS, false> {
+  protected:
+    void storeArea (uint8_t, uint8_t) {}
+};
+
+//============================================================================================//
+/*!
+  @brief  Gesture ID storage of CSE_FT6206_Lite. Empty when gestures are not used.
+*/
+template <bool ENABLED>
+class CSE_FT6206_LiteGesture {
+  public:
+    uint8_t gestureID;
+
+    uint8_t getGestureID (void) { return gestureID; }
+
+  protected:
+    void storeGesture (uint8_t id) { gestureID = id; }
+};
+
+template <>
+class CSE_FT6206_LiteGesture <false> {
+  protected:
+    void storeGesture (uint8_t) {}
+};
+
+//============================================================================================//
+/*!
+  @brief  A minimal FT6206 driver configured at compile time, for boards where flash and
+  RAM are tight. The number of points, the rotation and the optional features are template
+  parameters, so the frame length and every register offset are constants, the rotation is
+  resolved without a switch per point, and the storage and decoding of unused features are
+  not compiled. Accessors of a disabled feature do not exist, so using one is a compile
+  error. Points are reported in the display resolution given in the constructor, which must
+  be the native resolution of the controller.
+
+  The driver reads the frame in one transfer and has no retries, interrupt mode, filters or
+  calibration. Use CSE_FT6206 when those are needed.
+
+  @tparam POINTS The number of points decoded, 1 or 2. With 1, a second finger is ignored.
+  @tparam ROTATION The rotation of the display, 0-3.
+  @tparam FEATURES FT6206_LITE_* flags.
+*/
+template <uint8_t POINTS = FT6206_MAX_TOUCH_POINTS, uint8_t ROTATION = 0, uint8_t FEATURES = FT6206_LITE_ALL>
+class CSE_FT6206_Lite : public CSE_FT6206_LiteArea <POINTS, (FEATURES & FT6206_LITE_AREA) != 0>,
+  public CSE_FT6206_LiteGesture <(FEATURES & FT6206_LITE_GESTURE) != 0> {
+  static_assert ((POINTS >= 1) && (POINTS <= FT6206_MAX_TOUCH_POINTS), "POINTS must be 1 or 2");
+  static_assert (ROTATION < 4, "ROTATION must be 0-3");
+
+  public:
+    static const uint8_t FRAME_LENGTH = FT62XX_REG_P1_XH + (POINTS * 6);  // Bytes read per frame
+
+    uint8_t touches;  // Number of touches, at most POINTS
+    CSE_TouchPoint touchPoints [POINTS];
+
+    CSE_FT6206_Lite (uint16_t width, uint16_t height, TwoWire *i2c = &Wire, int8_t pinRst = -1);
+
+    bool begin (void);  // Resets the controller, waits for it and sets the threshold
+    bool readData (void); // Reads a new frame, false if the read failed
+
+    bool isTouched (void) { return touches > 0; }
+    uint8_t getTouches (void) { return touches; }
+    CSE_TouchPoint getPoint (uint8_t n = 0) { return (n < POINTS) ? touchPoints [n] : CSE_TouchPoint(); }
+    uint16_t getWidth (void) { return (ROTATION & 1) ? defHeight : defWidth; }
+    uint16_t getHeight (void) { return (ROTATION & 1) ? defWidth : defHeight; }
+    static uint8_t getRotation (void) { return ROTATION; }
+
+  private:
+    TwoWire *wireInstance;
+    int8_t pinReset;
+    uint16_t defWidth, defHeight;
+
+    bool writeRegister8 (uint8_t reg, uint8_t value);
+};
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new driver.
+
+  @param  width The width of the unrotated display, the same as the controller.
+  @param  height The height of the unrotated display, the same as the controller.
+  @param  i2c The bus.
+  @param  pinRst The reset pin, or -1 if it is not connected.
+*/
+template <uint8_t POINTS, uint8_t ROTATION, uint8_t FEATURES>
+CSE_FT6206_Lite <POINTS, ROTATION, FEATURES>:: CSE_FT6206_Lite (uint16_t width, uint16_t height, TwoWire *i2c, int8_t pinRst) {
+  wireInstance = i2c;
+  pinReset = pinRst;
+  defWidth = width;
+  defHeight = height;
+  touches = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the bus, resets the controller if the reset pin is connected, waits for it
+  to boot and acknowledge, and sets the default touch threshold. Blocks for about 300 ms.
+
+  @returns True if the controller responded.
+*/
+template <uint8_t POINTS, uint8_t ROTATION, uint8_t FEATURES>
+bool CSE_FT6206_Lite <POINTS, ROTATION, FEATURES>:: begin (void) {
+  wireInstance->begin();
+
+  if (pinReset >= 0) {
+    pinMode (pinReset, OUTPUT);
+    digitalWrite (pinReset, HIGH);
+    delay (FT6206_RESET_PULSE_MS);
+    digitalWrite (pinReset, LOW);
+    delay (FT6206_RESET_PULSE_MS);
+    digitalWrite (pinReset, HIGH);
+    delay (FT6206_RESET_PULSE_MS);
+  }
+
+  delay (FT6206_BOOT_DELAY_MS);
+  uint32_t start = millis();
+
+  while (true) {
+    wireInstance->beginTransmission (FT62XX_I2C_ADDR);
+
+    if (wireInstance->endTransmission() == 0) {
+      break;
+    }
+
+    if ((millis() - start) >= FT6206_IDENTIFY_TIMEOUT_MS) {
+      return false;
+    }
+
+    delay (FT6206_IDENTIFY_RETRY_MS);
+  }
+
+  return writeRegister8 (FT62XX_REG_TH_GROUP, FT62XX_DEFAULT_THRESHOLD);
+}
+
+//============================================================================================//
+/**
+  @brief  Reads the status and point registers in one transfer and decodes them. The loop
+  over the points has a constant count, so the register offsets are constants, and the
+  rotation is selected at compile time.
+
+  @returns True if a frame was read, false if the read failed. The points keep the previous
+  frame then.
+*/
+template <uint8_t POINTS, uint8_t ROTATION, uint8_t FEATURES>
+bool CSE_FT6206_Lite <POINTS, ROTATION, FEATURES>:: readData (void) {
+  uint8_t i2cdat [FRAME_LENGTH];
+
+  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
+  wireInstance->write (uint8_t (FT62XX_REG_DEV_MODE));
+
+  if (wireInstance->endTransmission() != 0) {
+    return false;
+  }
+
+  if (wireInstance->requestFrom (uint8_t (FT62XX_I2C_ADDR), FRAME_LENGTH) != FRAME_LENGTH) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < FRAME_LENGTH; i++) {
+    i2cdat [i] = wireInstance->read();
+  }
+
+  // Values above 2 are invalid. Points beyond POINTS are not decoded.
+  uint8_t count = i2cdat [FT62XX_REG_TD_STATUS];
+  touches = (count > FT6206_MAX_TOUCH_POINTS) ? 0 : ((count > POINTS) ? POINTS : count);
+  this->storeGesture (i2cdat [FT62XX_REG_GEST_ID]);
+
+  for (uint8_t id = 0; id < POINTS; id++) {
+    const uint8_t *p = &i2cdat [FT62XX_REG_P1_XH + (id * 6)];
+    CSE_TouchPoint &point = touchPoints [id];
+    int16_t x = CSE_FT6206_Decoder:: getX (p);
+    int16_t y = CSE_FT6206_Decoder:: getY (p);
+
+    point.state = CSE_FT6206_Decoder:: getState (p);
+    point.id = CSE_FT6206_Decoder:: getID (p);
+    point.z = (FEATURES & FT6206_LITE_WEIGHT) ? CSE_FT6206_Decoder:: getWeight (p) : 0;
+    this->storeArea (id, CSE_FT6206_Decoder:: getArea (p));
+
+    switch (ROTATION) {
+      case 1: // x = y, y = height - x
+        point.x = y;
+        point.y = int16_t (defWidth - x);
+        break;
+      case 2: // x = width - x, y = height - y
+        point.x = int16_t (defWidth - x);
+        point.y = int16_t (defHeight - y);
+        break;
+      case 3: // x = width - y, y = x
+        point.x = int16_t (defHeight - y);
+        point.y = x;
+        break;
+      default:
+        point.x = x;
+        point.y = y;
+        break;
+    }
+  }
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes a register.
+
+  @returns True if the controller acknowledged.
+*/
+template <uint8_t POINTS, uint8_t ROTATION, uint8_t FEATURES>
+bool CSE_FT6206_Lite <POINTS, ROTATION, FEATURES>:: writeRegister8 (uint8_t reg, uint8_t value) {
+  wireInstance->beginTransmission (FT62XX_I2C_ADDR);
+  wireInstance->write (reg);
+  wireInstance->write (value);
+  return (wireInstance->endTransmission() == 0);
+}
+
+//============================================================================================//
+
+#endif // CSE_FT6206_LITE_H
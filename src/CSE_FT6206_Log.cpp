@@ -0,0 +1,146 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Log.cpp
+  Description: Binary event log of the bus and frame activity for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 10:02:48 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+#include <stdio.h>
+
+static_assert ((FT6206_LOG_ENTRIES & (FT6206_LOG_ENTRIES - 1)) == 0, "FT6206_LOG_ENTRIES must be a power of 2");
+static_assert (FT6206_LOG_ENTRIES <= 0x8000, "FT6206_LOG_ENTRIES must fit the 16-bit counters");
+
+//============================================================================================//
+/**
+  @brief  Instantiates an empty log.
+*/
+CSE_FT6206_Log:: CSE_FT6206_Log (void) {
+  clear();
+}
+
+//============================================================================================//
+/**
+  @brief  Discards all records and the lost count.
+*/
+void CSE_FT6206_Log:: clear (void) {
+  head = 0;
+  tail = 0;
+  lost = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Moves the tail past the records that were overwritten since the last drain, and
+  counts them as lost. Logging does not move the tail, so that it stays a single store.
+*/
+void CSE_FT6206_Log:: catchUp (void) {
+  uint16_t pending = head - tail;
+
+  if (pending > FT6206_LOG_ENTRIES) {
+    lost += pending - FT6206_LOG_ENTRIES;
+    tail = head - FT6206_LOG_ENTRIES;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Takes the oldest record out of the log. Records are lost if more than 65535 are
+  logged between two drains.
+
+  @param  record Receives the record.
+
+  @returns True if a record was taken, false if the log is empty.
+*/
+bool CSE_FT6206_Log:: drain (CSE_FT6206_LogRecord &record) {
+  catchUp();
+
+  if (head == tail) {
+    return false;
+  }
+
+  record = records [tail & (FT6206_LOG_ENTRIES - 1)];
+  tail++;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of records waiting to be drained.
+*/
+uint16_t CSE_FT6206_Log:: getCount (void) {
+  catchUp();
+  return head - tail;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of records overwritten before they were drained.
+*/
+uint32_t CSE_FT6206_Log:: getLostCount (void) {
+  catchUp();
+  return lost;
+}
+
+//============================================================================================//
+/**
+  @brief  Formats a record as one line of text without a line ending, for example
+  "12000 READ $00 x15 = 0x00" or "12180 POINT 0 id 1 state 2 (100, 150)".
+
+  @param  record The record.
+  @param  buffer The text buffer, FT6206_LOG_TEXT_LENGTH bytes fit any record.
+  @param  size The size of the buffer.
+
+  @returns The length of the text, truncated to fit the buffer.
+*/
+uint8_t CSE_FT6206_Log:: format (const CSE_FT6206_LogRecord &record, char *buffer, uint8_t size) {
+  unsigned long time = record.time;
+  unsigned reg = record.reg;
+  unsigned low = record.value & 0xFF;
+  unsigned high = (record.value >> 8) & 0xFF;
+  int length = 0;
+
+  switch (record.event) {
+    case FT6206_LOG_READ:
+      length = snprintf (buffer, size, "%lu READ $%02X x%u = 0x%02X", time, reg, high, low);
+      break;
+
+    case FT6206_LOG_WRITE:
+      length = snprintf (buffer, size, "%lu WRITE $%02X x%u = 0x%02X", time, reg, high, low);
+      break;
+
+    case FT6206_LOG_ERROR:
+      length = snprintf (buffer, size, "%lu ERROR $%02X code %u", time, reg, low);
+      break;
+
+    case FT6206_LOG_FRAME:
+      length = snprintf (buffer, size, "%lu FRAME %u touches, %u bytes, gesture 0x%02X", time, reg, high, low);
+      break;
+
+    case FT6206_LOG_POINT:
+      length = snprintf (buffer, size, "%lu POINT %u id %u state %u (%d, %d)", time, reg >> 7, reg & 0x0F,
+        (reg >> 4) & 0x03, int (int16_t (record.value & 0xFFFF)), int (int16_t (record.value >> 16)));
+      break;
+
+    default:
+      length = snprintf (buffer, size, "%lu EVENT %u $%02X 0x%08lX", time, unsigned (record.event), reg,
+        (unsigned long) record.value);
+      break;
+  }
+
+  if (length < 0) {
+    length = 0;
+  }
+
+  return (length >= size) ? ((size > 0) ? (size - 1) : 0) : uint8_t (length);
+}
+
+//============================================================================================//
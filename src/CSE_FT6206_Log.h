@@ -0,0 +1,87 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Log.h
+  Description: Binary event log of the bus and frame activity for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_LOG_H
+#define CSE_FT6206_LOG_H
+
+#include "CSE_FT6206_Platform.h"
+
+#ifndef FT6206_LOG_ENTRIES
+  #define FT6206_LOG_ENTRIES              32  // Records kept in the ring, a power of 2
+#endif
+
+#define FT6206_LOG_TEXT_LENGTH            64  // Buffer size that fits any formatted record
+
+// Log events. The meaning of the register and value fields depends on the event.
+#define FT6206_LOG_READ                   0x01  // Register read. reg: first register, value: length << 8 | first byte
+#define FT6206_LOG_WRITE                  0x02  // Register write. reg: first register, value: length << 8 | first byte
+#define FT6206_LOG_ERROR                  0x03  // Transfer failed after all retries. reg: first register, value: FT6206_I2C_*
+#define FT6206_LOG_FRAME                  0x04  // Frame decoded. reg: touch count, value: length << 8 | gesture ID
+#define FT6206_LOG_POINT                  0x05  // Point decoded. reg: n << 7 | state << 4 | ID, value: y << 16 | x
+
+//============================================================================================//
+/*!
+  @brief  One log record.
+*/
+struct CSE_FT6206_LogRecord {
+  uint32_t time;  // micros() when the event was logged
+  uint32_t value;
+  uint8_t event;  // FT6206_LOG_*
+  uint8_t reg;
+};
+
+//============================================================================================//
+/*!
+  @brief  Records bus and frame events as fixed-size binary records into a RAM ring, so
+  that register-level tracing does not disturb the timing of the read path the way serial
+  prints do. Logging a record is a few stores and never blocks; when the ring is full the
+  oldest records are overwritten and counted as lost. The application drains and formats
+  the records whenever it chooses, for example after the bug has happened.
+
+  The panel logs into its own ring when CSE_FT6206_LOG is defined, see getLog().
+*/
+class CSE_FT6206_Log {
+  public:
+    CSE_FT6206_Log (void);
+
+    // Appends a record. Inline so that the read path only pays for the stores.
+    void record (uint8_t event, uint8_t reg, uint32_t value) {
+      CSE_FT6206_LogRecord &entry = records [head & (FT6206_LOG_ENTRIES - 1)];
+      entry.time = micros();
+      entry.value = value;
+      entry.event = event;
+      entry.reg = reg;
+      head++;
+    }
+
+    bool drain (CSE_FT6206_LogRecord &record);  // Takes the oldest record, false if empty
+    uint16_t getCount (void); // Records waiting to be drained
+    uint32_t getLostCount (void); // Records overwritten before they were drained
+    void clear (void);
+
+    static uint8_t format (const CSE_FT6206_LogRecord &record, char *buffer, uint8_t size); // One line of text
+
+  private:
+    CSE_FT6206_LogRecord records [FT6206_LOG_ENTRIES];
+    uint16_t head;  // Records logged, wraps
+    uint16_t tail;  // Records drained or lost, wraps
+    uint32_t lost;
+
+    void catchUp (void);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_LOG_H
@@ -0,0 +1,145 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Mux.cpp
+  Description: TCA9548A I2C multiplexer channel selection for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new multiplexer. The bus must be started before the first select().
+
+  @param  i2c The bus the multiplexer is on.
+  @param  address The I2C address of the multiplexer (0x70 to 0x77).
+*/
+#if !defined (CSE_FT6206_POSIX)
+CSE_FT6206_Mux:: CSE_FT6206_Mux (TwoWire *i2c, uint8_t address) : wireTransport (i2c) {
+  transport = &wireTransport;
+  this->address = address;
+  channel = FT6206_MUX_NONE;
+  switches = 0;
+}
+#endif
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new multiplexer on any transport. The transport must be started
+  before the first select().
+
+  @param  transport The transport of the bus the multiplexer is on, usually the one of the
+  panels.
+  @param  address The I2C address of the multiplexer (0x70 to 0x77).
+*/
+CSE_FT6206_Mux:: CSE_FT6206_Mux (CSE_FT6206_Transport *transport, uint8_t address) {
+  this->transport = transport;
+  this->address = address;
+  channel = FT6206_MUX_NONE;
+  switches = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Connects one downstream channel to the bus and disconnects the others. Does not
+  access the bus if the channel is already selected.
+
+  @param  channel The channel (0-7).
+
+  @returns True if the channel is selected.
+*/
+bool CSE_FT6206_Mux:: select (uint8_t channel) {
+  if (channel >= FT6206_MUX_NUM_CHANNELS) {
+    return false;
+  }
+
+  if (channel == this->channel) {
+    return true;
+  }
+
+  if (!writeControl (uint8_t (1 << channel))) {
+    return false;
+  }
+
+  this->channel = channel;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Disconnects all downstream channels.
+
+  @returns True if the multiplexer acknowledged.
+*/
+bool CSE_FT6206_Mux:: disable (void) {
+  if (!writeControl (0x00)) {
+    return false;
+  }
+
+  channel = FT6206_MUX_NONE;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Forgets the selected channel, so that the next select() writes the control
+  register. Call this after a reset of the multiplexer or when other code selected a
+  channel.
+*/
+void CSE_FT6206_Mux:: invalidate (void) {
+  channel = FT6206_MUX_NONE;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the selected channel, or FT6206_MUX_NONE if it is not known.
+*/
+uint8_t CSE_FT6206_Mux:: getChannel (void) {
+  return channel;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of control register writes since the last reset.
+*/
+uint32_t CSE_FT6206_Mux:: getSwitches (void) {
+  return switches;
+}
+
+//============================================================================================//
+/**
+  @brief  Clears the control register write counter.
+*/
+void CSE_FT6206_Mux:: resetSwitches (void) {
+  switches = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes the control register. The cached channel is forgotten if the write fails,
+  because the multiplexer state is then unknown.
+
+  @param  value One bit per channel.
+
+  @returns True if the multiplexer acknowledged.
+*/
+bool CSE_FT6206_Mux:: writeControl (uint8_t value) {
+  switches++;
+
+  // The control register has no address, the single byte written is its value.
+  if (transport->writeRegisters (address, value, NULL, 0) != FT6206_I2C_OK) {
+    channel = FT6206_MUX_NONE;
+    return false;
+  }
+
+  return true;
+}
+
+//============================================================================================//
@@ -0,0 +1,61 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Mux.h
+  Description: TCA9548A I2C multiplexer channel selection for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_MUX_H
+#define CSE_FT6206_MUX_H
+
+#include "CSE_FT6206_WireTransport.h"
+
+#define FT6206_MUX_I2C_ADDR               0x70  // Default address of the TCA9548A
+#define FT6206_MUX_NUM_CHANNELS           8
+#define FT6206_MUX_NONE                   0xFF  // No channel is known to be selected
+
+//============================================================================================//
+/*!
+  @brief  A TCA9548A (or PCA9548A/PCA9546A) I2C multiplexer shared by several panels. The
+  selected channel is cached, so the control register is only written when a panel on a
+  different channel accesses the bus. Call invalidate() if anything else writes the mux.
+
+  The control register is written through a transport, so the multiplexer works on every
+  bus the panels do. The TwoWire constructor wraps the bus in a CSE_FT6206_WireTransport.
+*/
+class CSE_FT6206_Mux {
+  public:
+#if !defined (CSE_FT6206_POSIX)
+    CSE_FT6206_Mux (TwoWire *i2c = &Wire, uint8_t address = FT6206_MUX_I2C_ADDR);
+#endif
+    CSE_FT6206_Mux (CSE_FT6206_Transport *transport, uint8_t address = FT6206_MUX_I2C_ADDR);
+
+    bool select (uint8_t channel);  // Writes the control register only if the channel changed
+    bool disable (void);  // Deselects all channels
+    void invalidate (void); // Forces the next select() to write the control register
+    uint8_t getChannel (void);  // FT6206_MUX_NONE if unknown
+    uint32_t getSwitches (void);  // Number of control register writes
+    void resetSwitches (void);
+
+  private:
+#if !defined (CSE_FT6206_POSIX)
+    CSE_FT6206_WireTransport wireTransport; // Used when the multiplexer is on a TwoWire bus
+#endif
+    CSE_FT6206_Transport *transport;
+    uint8_t address;
+    uint8_t channel;
+    uint32_t switches;
+
+    bool writeControl (uint8_t value);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_MUX_H
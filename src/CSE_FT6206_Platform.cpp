@@ -0,0 +1,136 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Platform.cpp
+  Description: POSIX timing and pin functions for Linux builds of the CSE_FT6206 Arduino
+  library without an Arduino core.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206_Platform.h"
+
+#if defined (CSE_FT6206_POSIX)
+
+#include <time.h>
+#include <errno.h>
+
+//============================================================================================//
+/**
+  @brief  Returns the monotonic time in microseconds.
+*/
+static uint64_t monotonicMicros (void) {
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (uint64_t (now.tv_sec) * 1000000ULL) + uint64_t (now.tv_nsec / 1000);
+}
+
+//============================================================================================//
+/**
+  @brief  Sleeps for at least the given time, resuming after signals.
+
+  @param  us The time in microseconds.
+*/
+static void sleepMicros (uint64_t us) {
+  struct timespec remaining;
+  remaining.tv_sec = time_t (us / 1000000ULL);
+  remaining.tv_nsec = long ((us % 1000000ULL) * 1000);
+
+  while ((nanosleep (&remaining, &remaining) != 0) && (errno == EINTR)) {
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the milliseconds since an arbitrary start, wrapping at 32 bits.
+*/
+uint32_t millis (void) {
+  return uint32_t (monotonicMicros() / 1000);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the microseconds since an arbitrary start, wrapping at 32 bits.
+*/
+uint32_t micros (void) {
+  return uint32_t (monotonicMicros());
+}
+
+//============================================================================================//
+/**
+  @brief  Sleeps for the given milliseconds.
+*/
+void delay (uint32_t ms) {
+  sleepMicros (uint64_t (ms) * 1000);
+}
+
+//============================================================================================//
+/**
+  @brief  Sleeps for the given microseconds. The scheduler may add to the time.
+*/
+void delayMicroseconds (uint32_t us) {
+  sleepMicros (us);
+}
+
+//============================================================================================//
+/**
+  @brief  Does nothing, the pins are not driven on Linux.
+*/
+void pinMode (uint8_t pin, uint8_t mode) {
+  (void) pin;
+  (void) mode;
+}
+
+//============================================================================================//
+/**
+  @brief  Does nothing, the pins are not driven on Linux.
+*/
+void digitalWrite (uint8_t pin, uint8_t val) {
+  (void) pin;
+  (void) val;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns HIGH, the idle level of the reset and interrupt lines.
+*/
+int digitalRead (uint8_t pin) {
+  (void) pin;
+  return HIGH;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns -1, no pin can interrupt on Linux.
+*/
+int digitalPinToInterrupt (uint8_t pin) {
+  (void) pin;
+  return -1;
+}
+
+//============================================================================================//
+/**
+  @brief  Does nothing, no pin can interrupt on Linux.
+*/
+void attachInterrupt (uint8_t interruptNum, void (*isr) (void), int mode) {
+  (void) interruptNum;
+  (void) isr;
+  (void) mode;
+}
+
+//============================================================================================//
+/**
+  @brief  Does nothing, no pin can interrupt on Linux.
+*/
+void detachInterrupt (uint8_t interruptNum) {
+  (void) interruptNum;
+}
+
+#endif // CSE_FT6206_POSIX
+
+//============================================================================================//
@@ -0,0 +1,91 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Platform.h
+  Description: Timing and pin functions used by the CSE_FT6206 Arduino library, with a
+  POSIX implementation for Linux builds without an Arduino core.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 01:32:05 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_PLATFORM_H
+#define CSE_FT6206_PLATFORM_H
+
+// Every library file includes this header instead of Arduino.h. With an Arduino core the
+// core provides everything. A Linux build without one (ARDUINO not defined) gets the
+// functions below, and CSE_FT6206_POSIX is defined so that the TwoWire backend and the
+// constructors that take a TwoWire are left out. Use CSE_FT6206_LinuxI2C as the transport.
+#if defined (ARDUINO) || !defined (__linux__)
+
+#include <Arduino.h>
+#include <CSE_Touch.h>
+
+#else
+
+#define CSE_FT6206_POSIX
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+
+#define HIGH                              0x1
+#define LOW                               0x0
+
+#define INPUT                             0x0
+#define OUTPUT                            0x1
+#define INPUT_PULLUP                      0x2
+
+#define FALLING                           2
+
+#define constrain(amt, low, high)         ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+//============================================================================================//
+// Timing from CLOCK_MONOTONIC. millis() and micros() wrap like on Arduino.
+
+uint32_t millis (void);
+uint32_t micros (void);
+void delay (uint32_t ms);
+void delayMicroseconds (uint32_t us);
+
+//============================================================================================//
+// There is no portable GPIO on Linux, so the pins are not driven. Pass -1 for the reset and
+// interrupt pins, and poll with read() or service() instead of using the interrupt mode.
+
+void pinMode (uint8_t pin, uint8_t mode);
+void digitalWrite (uint8_t pin, uint8_t val);
+int digitalRead (uint8_t pin);  // Always HIGH, the idle level of the reset and interrupt lines
+int digitalPinToInterrupt (uint8_t pin);  // Always -1, no pin can interrupt
+void attachInterrupt (uint8_t interruptNum, void (*isr) (void), int mode);
+void detachInterrupt (uint8_t interruptNum);
+
+//============================================================================================//
+/*!
+  @brief  A touch point, compatible with the one of the CSE_Touch library that the Arduino
+  builds use.
+*/
+class CSE_TouchPoint {
+  public:
+    int16_t x, y, z;
+    uint8_t state;
+    uint8_t id;
+
+    CSE_TouchPoint (void) : x (0), y (0), z (0), state (0), id (0) {}
+    CSE_TouchPoint (int16_t x, int16_t y, int16_t z, uint8_t id = 0) : x (x), y (y), z (z), state (0), id (id) {}
+
+    bool operator== (const CSE_TouchPoint &p) const { return (x == p.x) && (y == p.y) && (z == p.z); }
+    bool operator!= (const CSE_TouchPoint &p) const { return !(*this == p); }
+};
+
+#endif // ARDUINO
+
+//============================================================================================//
+
+#endif // CSE_FT6206_PLATFORM_H
@@ -0,0 +1,300 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Power.cpp
+  Description: Activity-adaptive scan rate and power mode manager for the CSE_FT6206
+  Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 02:08:14 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new power manager for a panel.
+
+  @param  panel The panel to manage.
+*/
+CSE_FT6206_Power:: CSE_FT6206_Power (CSE_FT6206 *panel) {
+  this->panel = panel;
+  state = FT6206_POWER_ACTIVE;
+  lastSeq = 0;
+  lastMove = 0;
+  lastTouch = 0;
+  lastPoll = 0;
+  lastHibernate = 0;
+  transitions = 0;
+  hibernateFailed = false;
+  profileSaved = false;
+  setScanRates();
+  setIdleTimes();
+  setPollIntervals();
+}
+
+//============================================================================================//
+/**
+  @brief  Enables the automatic monitor mode of the controller with the monitor time as its
+  timeout, and sets the normal scan rate. Call this after the panel is initialized.
+
+  @returns True if the registers were written and read back.
+*/
+bool CSE_FT6206_Power:: begin (void) {
+  uint32_t now = millis();
+  uint32_t seconds = (monitorTime + 999) / 1000;
+  seconds = (seconds < 1) ? 1 : ((seconds > 255) ? 255 : seconds);
+
+  state = FT6206_POWER_ACTIVE;
+  lastSeq = panel->getFrameSeq();
+  lastMove = now - moveHoldTime;
+  lastTouch = now;
+  lastPoll = now;
+  hibernateFailed = false;
+
+  return panel->setAutoMonitor (true) && panel->setMonitorTimeout (uint8_t (seconds)) &&
+    panel->setActiveScanRate (stillRate);
+}
+
+//============================================================================================//
+/**
+  @brief  Consumes the latest frame of the panel and changes the state if needed. Call this
+  from the loop, after each read of the panel. While waking, this also runs the
+  initialization of the panel and restores its configuration when it is ready.
+*/
+void CSE_FT6206_Power:: update (void) {
+  uint32_t now = millis();
+
+  if (state == FT6206_POWER_WAKING) {
+    uint8_t init = panel->poll();
+
+    if (init == FT6206_INIT_READY) {
+      if (profileSaved) {
+        panel->applyProfile (profile);
+      }
+
+      lastSeq = panel->getFrameSeq();
+      lastMove = now - moveHoldTime;
+      lastTouch = now;
+      enter (FT6206_POWER_ACTIVE);
+    }
+    else if (init == FT6206_INIT_FAILED) {
+      enter (FT6206_POWER_HIBERNATE);
+    }
+
+    return;
+  }
+
+  if (state == FT6206_POWER_HIBERNATE) {
+    return;
+  }
+
+  // A touch-down, a movement beyond the hysteresis and a lift-up all count as movement.
+  if (panel->getFrameSeq() != lastSeq) {
+    lastSeq = panel->getFrameSeq();
+
+    if (panel->touches > 0) {
+      lastTouch = now;
+    }
+
+    if (panel->getChangedMask() != 0) {
+      lastMove = now;
+    }
+  }
+
+  uint32_t idle = now - lastTouch;
+
+  if ((hibernateTime != 0) && (idle >= hibernateTime)) {
+    enter (FT6206_POWER_HIBERNATE);
+  }
+  else if (idle >= monitorTime) {
+    enter (FT6206_POWER_MONITOR);
+  }
+  else if ((now - lastMove) < moveHoldTime) {
+    enter (FT6206_POWER_MOVING);
+  }
+  else {
+    enter (FT6206_POWER_ACTIVE);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Tells when the host should read the next frame. A pending interrupt or a low INT
+  line makes the read due at once, so that the first touch is not delayed by a long poll
+  interval.
+
+  @returns True if the panel should be read now.
+*/
+bool CSE_FT6206_Power:: isPollDue (void) {
+  uint32_t interval = getPollInterval();
+
+  if (interval == 0) {
+    return false;
+  }
+
+  uint32_t now = millis();
+
+  if (panel->isFramePending() || panel->isInterruptAsserted() || ((now - lastPoll) >= interval)) {
+    lastPoll = now;
+    return true;
+  }
+
+  return false;
+}
+
+//============================================================================================//
+/**
+  @brief  Leaves the hibernation by resetting the controller. The initialization and the
+  restore of the configuration run in the following update() calls, after which the state
+  is FT6206_POWER_ACTIVE.
+
+  @returns True if the wake was started, false if the panel is not hibernating or has no
+  reset pin.
+*/
+bool CSE_FT6206_Power:: wake (void) {
+  if ((state != FT6206_POWER_HIBERNATE) || (!panel->wake())) {
+    return false;
+  }
+
+  state = FT6206_POWER_WAKING;
+  transitions++;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the state, one of FT6206_POWER_*.
+*/
+uint8_t CSE_FT6206_Power:: getState (void) {
+  return state;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the host poll interval of the current state in milliseconds, or 0 if the
+  panel should not be read.
+*/
+uint32_t CSE_FT6206_Power:: getPollInterval (void) {
+  switch (state) {
+    case FT6206_POWER_MOVING:
+      return movingPoll;
+
+    case FT6206_POWER_ACTIVE:
+      return activePoll;
+
+    case FT6206_POWER_MONITOR:
+      return monitorPoll;
+
+    default:
+      return 0;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of state changes.
+*/
+uint32_t CSE_FT6206_Power:: getTransitions (void) {
+  return transitions;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the active scan rates.
+
+  @param  moving The rate while fingers move.
+  @param  still The rate otherwise.
+*/
+void CSE_FT6206_Power:: setScanRates (uint8_t moving, uint8_t still) {
+  movingRate = moving;
+  stillRate = still;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the times after which the state steps down. Call begin() again after
+  changing the monitor time, so that the controller uses it too.
+
+  @param  moveHoldMs Time without movement before the fast scan rate is dropped.
+  @param  monitorMs Time without a touch before the monitor mode.
+  @param  hibernateMs Time without a touch before hibernating, 0 to never hibernate. Needs
+  the reset pin to wake.
+*/
+void CSE_FT6206_Power:: setIdleTimes (uint32_t moveHoldMs, uint32_t monitorMs, uint32_t hibernateMs) {
+  moveHoldTime = moveHoldMs;
+  monitorTime = monitorMs;
+  hibernateTime = hibernateMs;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the host poll intervals returned by getPollInterval().
+
+  @param  movingMs The interval while fingers move.
+  @param  activeMs The interval in the active state.
+  @param  monitorMs The interval in the monitor state.
+*/
+void CSE_FT6206_Power:: setPollIntervals (uint16_t movingMs, uint16_t activeMs, uint16_t monitorMs) {
+  movingPoll = movingMs;
+  activePoll = activeMs;
+  monitorPoll = monitorMs;
+}
+
+//============================================================================================//
+/**
+  @brief  Changes the state and writes the registers the new state needs. The fast scan
+  rate is written when movement starts and the normal rate when it stops. Before
+  hibernating, the configuration is saved so that wake() can restore it. If the controller
+  does not take the hibernation, a moving panel is left active and the hibernation is tried
+  again after the monitor poll interval.
+
+  @param  next The new state.
+*/
+void CSE_FT6206_Power:: enter (uint8_t next) {
+  if (next == state) {
+    return;
+  }
+
+  if ((state == FT6206_POWER_MOVING) && (next != FT6206_POWER_MOVING)) {
+    panel->setActiveScanRate (stillRate);
+  }
+
+  if (next == FT6206_POWER_MOVING) {
+    panel->setActiveScanRate (movingRate);
+  }
+  else if ((next == FT6206_POWER_HIBERNATE) && (state != FT6206_POWER_WAKING)) {
+    uint32_t now = millis();
+
+    // A failed hibernation is tried again once per monitor poll interval.
+    if (hibernateFailed && ((now - lastHibernate) < monitorPoll)) {
+      return;
+    }
+
+    profileSaved = panel->getProfile (profile);
+
+    if (!panel->hibernate()) {
+      hibernateFailed = true;
+      lastHibernate = now;
+
+      // The normal scan rate was written above, so a moving panel is left active instead of
+      // writing it again on every retry.
+      if (state == FT6206_POWER_MOVING) {
+        state = FT6206_POWER_ACTIVE;
+        transitions++;
+      }
+
+      return;
+    }
+  }
+
+  state = next;
+  hibernateFailed = false;
+  transitions++;
+}
+
+//============================================================================================//
@@ -0,0 +1,90 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Power.h
+  Description: Activity-adaptive scan rate and power mode manager for the CSE_FT6206
+  Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 02:08:14 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_POWER_H
+#define CSE_FT6206_POWER_H
+
+#include "CSE_FT6206_Platform.h"
+
+// Power states
+#define FT6206_POWER_MOVING               0x00  // Fingers are moving, the fast scan rate is used
+#define FT6206_POWER_ACTIVE               0x01  // Touched or recently touched, the normal scan rate is used
+#define FT6206_POWER_MONITOR              0x02  // Idle, the controller is in the monitor mode
+#define FT6206_POWER_HIBERNATE            0x03  // Long idle, the controller is off until wake()
+#define FT6206_POWER_WAKING               0x04  // The controller is being reset and configured
+
+// Default parameters
+#define FT6206_DEFAULT_MOVING_RATE        14    // Active scan rate while fingers move
+#define FT6206_DEFAULT_STILL_RATE         6     // Active scan rate otherwise
+#define FT6206_DEFAULT_MOVE_HOLD_MS       500   // Time without movement before the fast rate is dropped
+#define FT6206_DEFAULT_MONITOR_MS         5000  // Time without touch before the monitor mode
+#define FT6206_DEFAULT_HIBERNATE_MS       0     // Time without touch before hibernating, 0 to never hibernate
+#define FT6206_DEFAULT_MOVING_POLL_MS     8     // Host poll interval while fingers move
+#define FT6206_DEFAULT_ACTIVE_POLL_MS     16    // Host poll interval in the active state
+#define FT6206_DEFAULT_MONITOR_POLL_MS    50    // Host poll interval in the monitor state
+
+class CSE_FT6206;
+
+//============================================================================================//
+/*!
+  @brief  Adapts the controller and the host to the touch activity. The fast scan rate is
+  set as soon as a frame shows movement, and dropped only after the move hold time without
+  movement, so that the rate does not flap with the movement of a finger. After the
+  monitor time without a touch, the controller enters the monitor mode on its own and the
+  host polls less often. After the hibernate time, the controller is put into hibernation
+  and the host stops polling until wake(), which resets the controller through the reset
+  pin and restores its configuration. Registers are only written on state changes.
+*/
+class CSE_FT6206_Power {
+  public:
+    CSE_FT6206_Power (CSE_FT6206 *panel);
+
+    bool begin (void);  // Configures the controller, call after the panel is initialized
+    void update (void); // Consumes the latest frame and changes the state, call from the loop
+    bool isPollDue (void);  // True when the host should read the next frame
+    bool wake (void); // Leaves the hibernation, completes in later update() calls
+
+    uint8_t getState (void);  // One of FT6206_POWER_*
+    uint32_t getPollInterval (void);  // Host poll interval of the current state in ms, 0 if not polling
+    uint32_t getTransitions (void); // Number of state changes
+
+    void setScanRates (uint8_t moving = FT6206_DEFAULT_MOVING_RATE, uint8_t still = FT6206_DEFAULT_STILL_RATE);
+    void setIdleTimes (uint32_t moveHoldMs = FT6206_DEFAULT_MOVE_HOLD_MS, uint32_t monitorMs = FT6206_DEFAULT_MONITOR_MS,
+      uint32_t hibernateMs = FT6206_DEFAULT_HIBERNATE_MS);
+    void setPollIntervals (uint16_t movingMs = FT6206_DEFAULT_MOVING_POLL_MS, uint16_t activeMs = FT6206_DEFAULT_ACTIVE_POLL_MS,
+      uint16_t monitorMs = FT6206_DEFAULT_MONITOR_POLL_MS);
+
+  private:
+    CSE_FT6206 *panel;
+    uint8_t state;
+    uint8_t movingRate, stillRate;
+    uint32_t moveHoldTime, monitorTime, hibernateTime;
+    uint16_t movingPoll, activePoll, monitorPoll;
+    uint32_t lastSeq; // Sequence number of the last frame consumed
+    uint32_t lastMove;  // millis() of the last frame with movement
+    uint32_t lastTouch; // millis() of the last frame with a touch
+    uint32_t lastPoll;  // millis() of the last due poll
+    uint32_t lastHibernate; // millis() of the last failed hibernation
+    uint32_t transitions;
+    bool hibernateFailed;
+    bool profileSaved;
+    CSE_FT6206_Profile profile; // Configuration restored after a wake
+
+    void enter (uint8_t state);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_POWER_H
@@ -0,0 +1,222 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Predictor.cpp
+  Description: Touch position prediction for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 09:37:15 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+#define FT6206_PREDICT_FRACTION_BITS      4       // Sub-pixel bits of the velocities and offsets
+#define FT6206_PREDICT_MAX_DT             100000  // Longest sample interval in microseconds, longer restarts the estimate
+#define FT6206_PREDICT_MAX_VELOCITY       32767   // Largest velocity, 2047 pixels per millisecond
+#define FT6206_PREDICT_MAX_ACCELERATION   32767   // Largest acceleration
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new predictor.
+
+  @param  lookahead How far ahead to predict, in milliseconds.
+*/
+CSE_FT6206_Predictor:: CSE_FT6206_Predictor (uint8_t lookahead) {
+  setLookahead (lookahead);
+  setMaxDistance();
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Forgets all fingers. The next samples are reported without prediction until the
+  velocity is known again.
+*/
+void CSE_FT6206_Predictor:: reset (void) {
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    states [i].active = false;
+    states [i].id = 0;
+    states [i].samples = 0;
+    states [i].timestamp = 0;
+    predicted [i] = CSE_TouchPoint();
+    predicted [i].state = FT62XX_TOUCH_NONE;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how far ahead the position is predicted. Set it close to the latency from the
+  touch to the pixels on the display.
+
+  @param  lookahead The lookahead in milliseconds, up to FT6206_PREDICT_MAX_LOOKAHEAD_MS. 0
+  reports the measured points.
+*/
+void CSE_FT6206_Predictor:: setLookahead (uint8_t lookahead) {
+  this->lookahead = (lookahead > FT6206_PREDICT_MAX_LOOKAHEAD_MS) ? FT6206_PREDICT_MAX_LOOKAHEAD_MS : lookahead;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the lookahead in milliseconds.
+*/
+uint8_t CSE_FT6206_Predictor:: getLookahead (void) {
+  return lookahead;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the largest distance a point is moved ahead along each axis, which bounds
+  the error when the finger stops suddenly.
+
+  @param  distance The distance in pixels.
+*/
+void CSE_FT6206_Predictor:: setMaxDistance (uint16_t distance) {
+  maxDistance = (distance > 2047) ? 2047 : distance;
+}
+
+//============================================================================================//
+/**
+  @brief  Predicts the points of a new frame. Called by the panel for every frame when the
+  predictor is attached with attachPredictor(). Points that are not in contact are
+  reported as they are.
+
+  @param  points The points of the frame.
+  @param  count The number of entries in points.
+  @param  width The width of the display in its current rotation.
+  @param  height The height of the display in its current rotation.
+  @param  timestamp The micros() timestamp of the frame.
+*/
+void CSE_FT6206_Predictor:: update (const CSE_TouchPoint *points, uint8_t count, uint16_t width, uint16_t height, uint32_t timestamp) {
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    CSE_FT6206_PredictorState &state = states [p];
+    CSE_TouchPoint &point = predicted [p];
+
+    if (p >= count) {
+      point = CSE_TouchPoint();
+      point.state = FT62XX_TOUCH_NONE;
+      state.active = false;
+      continue;
+    }
+
+    point = points [p];
+
+    if ((point.state != FT62XX_TOUCH_DOWN) && (point.state != FT62XX_TOUCH_CONTACT)) {
+      state.active = false;
+      continue;
+    }
+
+    uint32_t dt = timestamp - state.timestamp;
+
+    if ((!state.active) || (point.state == FT62XX_TOUCH_DOWN) || (state.id != point.id) ||
+        (dt == 0) || (dt > FT6206_PREDICT_MAX_DT)) {
+      restart (state, point, timestamp);
+      continue;
+    }
+
+    state.timestamp = timestamp;
+    state.samples = (state.samples < 3) ? (state.samples + 1) : 3;
+
+    int16_t x = predictAxis (state, 0, point.x, dt);
+    int16_t y = predictAxis (state, 1, point.y, dt);
+    point.x = (x < 0) ? 0 : ((x >= int16_t (width)) ? int16_t (width - 1) : x);
+    point.y = (y < 0) ? 0 : ((y >= int16_t (height)) ? int16_t (height - 1) : y);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns a predicted point of the last frame. Only the position differs from the
+  point of the panel.
+
+  @param  n The index of the point.
+*/
+CSE_TouchPoint CSE_FT6206_Predictor:: getPoint (uint8_t n) {
+  return (n < FT6206_MAX_TOUCH_POINTS) ? predicted [n] : CSE_TouchPoint();
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the estimate of a finger from a single sample, after a touch-down, a new
+  hardware ID in the slot or a long gap between frames.
+*/
+void CSE_FT6206_Predictor:: restart (CSE_FT6206_PredictorState &state, const CSE_TouchPoint &point, uint32_t timestamp) {
+  state.active = true;
+  state.id = point.id;
+  state.samples = 1;
+  state.timestamp = timestamp;
+  state.last [0] = point.x;
+  state.last [1] = point.y;
+
+  for (uint8_t axis = 0; axis < 2; axis++) {
+    state.velocity [axis] = 0;
+    state.acceleration [axis] = 0;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Updates the velocity and acceleration of one axis and extrapolates it. The
+  velocity is averaged over two samples, and the acceleration needs three. A sample that
+  moves against the velocity clears both, so that axis is not extrapolated until it moves
+  again, and a deceleration can shorten the extrapolation but not reverse it.
+
+  @param  state The finger state.
+  @param  axis 0 for X and 1 for Y.
+  @param  sample The new measured position.
+  @param  dt Time since the previous sample in microseconds, 1 to FT6206_PREDICT_MAX_DT.
+
+  @returns The predicted position in pixels.
+*/
+int16_t CSE_FT6206_Predictor:: predictAxis (CSE_FT6206_PredictorState &state, uint8_t axis, int16_t sample, uint32_t dt) {
+  int32_t delta = int32_t (sample - state.last [axis]) << FT6206_PREDICT_FRACTION_BITS;
+  int32_t &velocity = state.velocity [axis];
+  int32_t &acceleration = state.acceleration [axis];
+  int32_t previous = velocity;
+  state.last [axis] = sample;
+
+  // Velocity of this sample in 1/16 pixels per millisecond. The delta is at most 4095 pixels.
+  int32_t raw = (delta * 1000L) / int32_t (dt);
+  raw = constrain (raw, -FT6206_PREDICT_MAX_VELOCITY, FT6206_PREDICT_MAX_VELOCITY);
+
+  if (((raw > 0) && (previous < 0)) || ((raw < 0) && (previous > 0))) {
+    velocity = 0;
+    acceleration = 0;
+    return sample;
+  }
+
+  velocity = (previous == 0) ? raw : ((previous + raw) / 2);
+
+  if ((state.samples >= 3) && (previous != 0)) {
+    // Limit the velocity change so that the product fits in 32 bits.
+    int32_t change = constrain (velocity - previous, -2000L, 2000L);
+    change = (change * 1000000L) / int32_t (dt);
+    change = constrain (change, -FT6206_PREDICT_MAX_ACCELERATION, FT6206_PREDICT_MAX_ACCELERATION);
+    acceleration = (acceleration + change) / 2;
+  }
+  else {
+    acceleration = 0;
+  }
+
+  if (lookahead == 0) {
+    return sample;
+  }
+
+  // Offset in 1/16 pixels: v * t + a * t^2 / 2, with t in milliseconds.
+  int32_t t = lookahead;
+  int32_t offset = (velocity * t) + ((acceleration * t * t) / 2000L);
+
+  if (((offset > 0) && (velocity < 0)) || ((offset < 0) && (velocity > 0)) || (velocity == 0)) {
+    offset = 0;
+  }
+
+  int32_t limit = int32_t (maxDistance) << FT6206_PREDICT_FRACTION_BITS;
+  offset = constrain (offset, -limit, limit);
+
+  return int16_t (sample + ((offset + (1 << (FT6206_PREDICT_FRACTION_BITS - 1))) >> FT6206_PREDICT_FRACTION_BITS));
+}
+
+//============================================================================================//
@@ -0,0 +1,76 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Predictor.h
+  Description: Touch position prediction for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_PREDICTOR_H
+#define CSE_FT6206_PREDICTOR_H
+
+#include "CSE_FT6206_Platform.h"
+
+#define FT6206_DEFAULT_LOOKAHEAD_MS       24    // How far ahead the position is predicted
+#define FT6206_PREDICT_MAX_LOOKAHEAD_MS   100   // Longest lookahead accepted
+#define FT6206_DEFAULT_PREDICT_DISTANCE   48    // Largest distance in pixels a point is moved ahead
+
+//============================================================================================//
+/*!
+  @brief  Prediction state of one finger. Velocities are in 1/16 pixels per millisecond and
+  accelerations in 1/16 pixels per millisecond per second.
+*/
+struct CSE_FT6206_PredictorState {
+  bool active;
+  uint8_t id; // Hardware ID nibble of the finger
+  uint8_t samples;  // Samples since touch-down, up to 3
+  uint32_t timestamp; // Timestamp of the last sample
+  int16_t last [2]; // Last position of each axis
+  int32_t velocity [2];
+  int32_t acceleration [2];
+};
+
+//============================================================================================//
+/*!
+  @brief  Predicts where each finger will be a short time ahead, to hide the latency of the
+  scan, the bus and the rendering while dragging. The velocity and acceleration of each
+  axis are estimated from the timestamped frames, and the position is extrapolated by the
+  lookahead, limited to a maximum distance and to the display. The prediction is turned
+  off for an axis that reverses its direction, and on touch-down and lift-off the actual
+  position is reported, so that a stroke does not overshoot its ends. All math is integer.
+
+  Attach the predictor to a panel with attachPredictor() and read the predicted points with
+  getPoint(). The points of the panel are not changed, so the tracker, the gesture
+  recognizer and the hit test still see the measured positions.
+*/
+class CSE_FT6206_Predictor {
+  public:
+    CSE_FT6206_Predictor (uint8_t lookahead = FT6206_DEFAULT_LOOKAHEAD_MS);
+
+    void update (const CSE_TouchPoint *points, uint8_t count, uint16_t width, uint16_t height, uint32_t timestamp);
+    void reset (void);
+    CSE_TouchPoint getPoint (uint8_t n = 0);  // Predicted point n of the last frame
+
+    void setLookahead (uint8_t lookahead = FT6206_DEFAULT_LOOKAHEAD_MS);  // In milliseconds, 0 disables the prediction
+    uint8_t getLookahead (void);
+    void setMaxDistance (uint16_t distance = FT6206_DEFAULT_PREDICT_DISTANCE); // In pixels
+
+  private:
+    uint8_t lookahead;
+    uint16_t maxDistance;
+    CSE_FT6206_PredictorState states [FT6206_MAX_TOUCH_POINTS];
+    CSE_TouchPoint predicted [FT6206_MAX_TOUCH_POINTS];
+
+    int16_t predictAxis (CSE_FT6206_PredictorState &state, uint8_t axis, int16_t sample, uint32_t dt);
+    void restart (CSE_FT6206_PredictorState &state, const CSE_TouchPoint &point, uint32_t timestamp);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_PREDICTOR_H
@@ -0,0 +1,256 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Resampler.cpp
+  Description: Resampling of the touch points to the display refresh for the CSE_FT6206
+  Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 11:48:26 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+#define FT6206_RESAMPLE_FRACTION_BITS     12        // Bits of the interpolation fraction
+#define FT6206_RESAMPLE_MAX_SPAN          0xFFFFFUL // Longest interval that fits the fraction math
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new resampler.
+
+  @param  lookback The longest time the output lags the newest frame, in microseconds.
+*/
+CSE_FT6206_Resampler:: CSE_FT6206_Resampler (uint32_t lookback) {
+  setMaxLookback (lookback);
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Forgets all fingers and the events not yet reported.
+*/
+void CSE_FT6206_Resampler:: reset (void) {
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    states [i].active = false;
+    states [i].samples = 0;
+    states [i].newest = 0;
+    states [i].edgeCount = 0;
+    output [i] = CSE_TouchPoint();
+    output [i].state = FT62XX_TOUCH_NONE;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how far before the newest frame an output time can reach. Earlier times are
+  moved up to this bound. Set it a little longer than the scan period of the controller.
+
+  @param  lookback The lookback in microseconds. 0 always reports the newest frame.
+*/
+void CSE_FT6206_Resampler:: setMaxLookback (uint32_t lookback) {
+  this->lookback = lookback;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the lookback in microseconds.
+*/
+uint32_t CSE_FT6206_Resampler:: getMaxLookback (void) {
+  return lookback;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds the points of a new frame to the history. Called by the panel for every
+  frame when the resampler is attached with attachResampler(). A point that lands, lifts or
+  changes its ID in a slot queues its edges.
+
+  @param  points The points of the frame.
+  @param  count The number of entries in points.
+  @param  timestamp The micros() timestamp of the frame.
+*/
+void CSE_FT6206_Resampler:: update (const CSE_TouchPoint *points, uint8_t count, uint32_t timestamp) {
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    CSE_FT6206_ResamplerState &state = states [p];
+    CSE_TouchPoint point;
+    point.state = FT62XX_TOUCH_NONE;
+
+    if (p < count) {
+      point = points [p];
+    }
+
+    bool contact = (point.state == FT62XX_TOUCH_DOWN) || (point.state == FT62XX_TOUCH_CONTACT);
+
+    // The finger lifted, or another finger took its slot. A lift-off without its own point
+    // is reported where the finger was last seen.
+    if (state.active && ((!contact) || (point.state == FT62XX_TOUCH_DOWN) || (point.id != state.last.id))) {
+      bool measured = (point.state == FT62XX_TOUCH_UP) && (point.id == state.last.id);
+      pushEdge (state, measured ? point : state.last, FT62XX_TOUCH_UP);
+      state.active = false;
+    }
+
+    if (!contact) {
+      continue;
+    }
+
+    if (!state.active) {
+      state.active = true;
+      state.samples = 0;
+      pushEdge (state, point, FT62XX_TOUCH_DOWN);
+    }
+
+    state.newest = (state.newest + 1) % FT6206_RESAMPLE_HISTORY;
+    state.time [state.newest] = timestamp;
+    state.x [state.newest] = point.x;
+    state.y [state.newest] = point.y;
+    state.samples = (state.samples < FT6206_RESAMPLE_HISTORY) ? (state.samples + 1) : FT6206_RESAMPLE_HISTORY;
+    state.last = point;
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Computes the points at an output time. A finger with a queued touch-down or
+  lift-off reports the oldest one instead, with its measured position. A finger in contact
+  reports its position interpolated at the time, as FT62XX_TOUCH_CONTACT.
+
+  @param  timestamp The output time in micros(), for example the time of the next display
+  refresh minus one scan period.
+*/
+void CSE_FT6206_Resampler:: sample (uint32_t timestamp) {
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    CSE_FT6206_ResamplerState &state = states [p];
+    CSE_TouchPoint &point = output [p];
+
+    if (state.edgeCount > 0) {
+      point = state.edges [0];
+      state.edgeCount--;
+
+      for (uint8_t i = 0; i < state.edgeCount; i++) {
+        state.edges [i] = state.edges [i + 1];
+      }
+
+      continue;
+    }
+
+    if (!state.active) {
+      point = CSE_TouchPoint();
+      point.state = FT62XX_TOUCH_NONE;
+      continue;
+    }
+
+    point = state.last;
+    point.state = FT62XX_TOUCH_CONTACT;
+    interpolate (state, timestamp, point);
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Returns a point computed by the last sample() call.
+
+  @param  n The index of the point.
+*/
+CSE_TouchPoint CSE_FT6206_Resampler:: getPoint (uint8_t n) {
+  return (n < FT6206_MAX_TOUCH_POINTS) ? output [n] : CSE_TouchPoint();
+}
+
+//============================================================================================//
+/**
+  @brief  Queues a touch-down or lift-off. When the queue is full because sample() is not
+  called, the oldest touch-down and lift-off pair is dropped, so that the events stay in
+  pairs.
+*/
+void CSE_FT6206_Resampler:: pushEdge (CSE_FT6206_ResamplerState &state, const CSE_TouchPoint &point, uint8_t event) {
+  if (state.edgeCount >= FT6206_RESAMPLE_EDGES) {
+    state.edgeCount -= 2;
+
+    for (uint8_t i = 0; i < state.edgeCount; i++) {
+      state.edges [i] = state.edges [i + 2];
+    }
+  }
+
+  CSE_TouchPoint &edge = state.edges [state.edgeCount++];
+  edge = point;
+  edge.state = event;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the position of a finger at an output time. The time is measured as an age
+  before the newest sample, so that the micros() rollover does not matter. A time after the
+  newest sample gives the newest position, one older than the lookback is moved up to it,
+  and one older than the history gives the oldest position.
+
+  @param  state The finger state, with at least one sample.
+  @param  timestamp The output time.
+  @param  point Receives the position.
+*/
+void CSE_FT6206_Resampler:: interpolate (const CSE_FT6206_ResamplerState &state, uint32_t timestamp, CSE_TouchPoint &point) {
+  uint32_t newestTime = state.time [state.newest];
+  int32_t age = int32_t (newestTime - timestamp);
+  uint8_t later = state.newest;
+
+  point.x = state.x [later];
+  point.y = state.y [later];
+
+  if (age <= 0) {
+    return;
+  }
+
+  if (uint32_t (age) > lookback) {
+    age = int32_t (lookback);
+  }
+
+  for (uint8_t k = 1; k < state.samples; k++) {
+    uint8_t earlier = (later + FT6206_RESAMPLE_HISTORY - 1) % FT6206_RESAMPLE_HISTORY;
+    uint32_t earlierAge = newestTime - state.time [earlier];
+
+    if (earlierAge >= uint32_t (age)) {
+      uint32_t span = state.time [later] - state.time [earlier];
+      uint32_t offset = earlierAge - uint32_t (age);  // From the earlier sample to the output time
+
+      point.x = blend (state.x [earlier], state.x [later], offset, span);
+      point.y = blend (state.y [earlier], state.y [later], offset, span);
+      return;
+    }
+
+    later = earlier;
+  }
+
+  point.x = state.x [later];
+  point.y = state.y [later];
+}
+
+//============================================================================================//
+/**
+  @brief  Interpolates linearly between two positions with a fixed-point fraction.
+
+  @param  from The earlier position.
+  @param  to The later position.
+  @param  offset Time from the earlier sample to the output time, up to span.
+  @param  span Time between the samples.
+
+  @returns The position at the offset, rounded to the nearest pixel.
+*/
+int16_t CSE_FT6206_Resampler:: blend (int16_t from, int16_t to, uint32_t offset, uint32_t span) {
+  if (span == 0) {
+    return to;
+  }
+
+  while (span > FT6206_RESAMPLE_MAX_SPAN) {
+    span >>= 1;
+    offset >>= 1;
+  }
+
+  int32_t fraction = int32_t ((offset << FT6206_RESAMPLE_FRACTION_BITS) / span);
+  int32_t delta = int32_t (to - from) * fraction;
+  int32_t half = int32_t (1) << (FT6206_RESAMPLE_FRACTION_BITS - 1);
+  return int16_t (from + ((delta + ((delta >= 0) ? half : -half)) / (int32_t (1) << FT6206_RESAMPLE_FRACTION_BITS)));
+}
+
+//============================================================================================//
@@ -0,0 +1,84 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Resampler.h
+  Description: Resampling of the touch points to the display refresh for the CSE_FT6206
+  Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_RESAMPLER_H
+#define CSE_FT6206_RESAMPLER_H
+
+#include "CSE_FT6206_Platform.h"
+
+#define FT6206_RESAMPLE_HISTORY           4     // Contact samples kept per finger
+#define FT6206_RESAMPLE_EDGES             4     // Touch-down and lift-off events queued per finger
+#define FT6206_DEFAULT_RESAMPLE_LOOKBACK  20000 // Longest time in microseconds the output lags the newest frame
+
+//============================================================================================//
+/*!
+  @brief  Resampling state of one finger. The history is a ring of the last contact samples,
+  and the edges are the touch-down and lift-off points not yet reported by sample().
+*/
+struct CSE_FT6206_ResamplerState {
+  bool active;  // In contact
+  uint8_t samples;  // Samples in the history, up to FT6206_RESAMPLE_HISTORY
+  uint8_t newest; // Index of the newest sample
+  uint8_t edgeCount;
+  uint32_t time [FT6206_RESAMPLE_HISTORY];  // Frame timestamps
+  int16_t x [FT6206_RESAMPLE_HISTORY];
+  int16_t y [FT6206_RESAMPLE_HISTORY];
+  CSE_TouchPoint last;  // Newest point as it was reported
+  CSE_TouchPoint edges [FT6206_RESAMPLE_EDGES];
+};
+
+//============================================================================================//
+/*!
+  @brief  Resamples the touch points to the output clock of the application, such as the
+  display refresh. The controller reports at its own scan rate, which drifts against the
+  display, so some display frames would see two new frames and others none, and a steady
+  scroll would judder. The resampler keeps the last frames of each finger with their
+  timestamps, and sample() interpolates the position of each finger at a requested time
+  between the two frames around it. The time is limited to the newest frame, so nothing is
+  extrapolated, and to the maximum lookback before it, which bounds the added latency.
+
+  A touch-down and a lift-off are never interpolated away. Each is queued and reported by
+  exactly one sample() call, at its measured position, in the order they happened; a tap
+  that starts and ends between two calls is reported as a touch-down, then a lift-off.
+
+  Attach the resampler to a panel with attachResampler(), then call sample() once per
+  display frame with a time about one scan period before the refresh, so that there are
+  frames on both sides of it. The points of the panel are not changed.
+*/
+class CSE_FT6206_Resampler {
+  public:
+    CSE_FT6206_Resampler (uint32_t lookback = FT6206_DEFAULT_RESAMPLE_LOOKBACK);
+
+    void update (const CSE_TouchPoint *points, uint8_t count, uint32_t timestamp);
+    void sample (uint32_t timestamp); // Resamples the points at an output time, in micros()
+    void reset (void);
+    CSE_TouchPoint getPoint (uint8_t n = 0);  // Point n at the last sample() time
+
+    void setMaxLookback (uint32_t lookback = FT6206_DEFAULT_RESAMPLE_LOOKBACK); // In microseconds
+    uint32_t getMaxLookback (void);
+
+  private:
+    uint32_t lookback;
+    CSE_FT6206_ResamplerState states [FT6206_MAX_TOUCH_POINTS];
+    CSE_TouchPoint output [FT6206_MAX_TOUCH_POINTS];
+
+    void pushEdge (CSE_FT6206_ResamplerState &state, const CSE_TouchPoint &point, uint8_t event);
+    void interpolate (const CSE_FT6206_ResamplerState &state, uint32_t timestamp, CSE_TouchPoint &point);
+    static int16_t blend (int16_t from, int16_t to, uint32_t offset, uint32_t span);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_RESAMPLER_H
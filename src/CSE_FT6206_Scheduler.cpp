@@ -0,0 +1,310 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Scheduler.cpp
+  Description: Polling scheduler for multiple panels for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 06:02:51 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new scheduler without panels.
+
+  @param  mode One of FT6206_SCHEDULE_*.
+*/
+CSE_FT6206_Scheduler:: CSE_FT6206_Scheduler (uint8_t mode) {
+  this->mode = mode;
+  count = 0;
+  cursor = 0;
+  tick = 0;
+  windowStart = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Adds a panel. A panel behind a multiplexer is visited right after the panels
+  already added on the same channel.
+
+  @param  panel The panel. Its multiplexer must be attached before it is added.
+  @param  priority The priority used in the FT6206_SCHEDULE_PRIORITY mode, higher first.
+
+  @returns The index of the panel, used to read its statistics, or -1 if the scheduler is
+  full.
+*/
+int8_t CSE_FT6206_Scheduler:: addPanel (CSE_FT6206 *panel, uint8_t priority) {
+  if ((panel == NULL) || (count >= FT6206_SCHEDULER_MAX_PANELS)) {
+    return -1;
+  }
+
+  CSE_FT6206_PanelSlot &slot = slots [count];
+  slot.panel = panel;
+  slot.priority = priority;
+  slot.lastServed = 0;
+  slot.frames = 0;
+  slot.windowFrames = 0;
+  slot.frameRate = 0;
+
+  // Insert after the last panel on the same multiplexer channel.
+  uint8_t position = count;
+
+  if (panel->getMux() != NULL) {
+    for (uint8_t i = 0; i < count; i++) {
+      CSE_FT6206 *other = slots [order [i]].panel;
+
+      if ((other->getMux() == panel->getMux()) && (other->getMuxChannel() == panel->getMuxChannel())) {
+        position = i + 1;
+      }
+    }
+  }
+
+  for (uint8_t i = count; i > position; i--) {
+    order [i] = order [i - 1];
+  }
+
+  order [position] = count;
+
+  if ((position < cursor) && (count > 0)) {
+    cursor++;
+  }
+
+  if (count == 0) {
+    windowStart = millis();
+  }
+
+  return int8_t (count++);
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of panels added.
+*/
+uint8_t CSE_FT6206_Scheduler:: getPanelCount (void) {
+  return count;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets how the next panel is chosen.
+
+  @param  mode FT6206_SCHEDULE_ROUND_ROBIN reads the due panels in turn.
+  FT6206_SCHEDULE_PRIORITY reads the due panel with the highest priority, and among equal
+  priorities prefers the panel on the selected multiplexer channel, then the panel that
+  waited longest. A busy panel with a higher priority can starve the others.
+*/
+void CSE_FT6206_Scheduler:: setMode (uint8_t mode) {
+  this->mode = mode;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the scheduling mode.
+*/
+uint8_t CSE_FT6206_Scheduler:: getMode (void) {
+  return mode;
+}
+
+//============================================================================================//
+/**
+  @brief  Reads frames from the due panels. Call this from the loop. Each read costs one
+  frame read on the bus, plus a multiplexer write if the panel is on another channel, so
+  the budget bounds the time spent in one call.
+
+  @param  budget The maximum number of panel reads.
+
+  @returns The number of frames read.
+*/
+uint8_t CSE_FT6206_Scheduler:: run (uint8_t budget) {
+  uint8_t read = 0;
+
+  for (uint8_t n = 0; n < budget; n++) {
+    int8_t slot = (mode == FT6206_SCHEDULE_PRIORITY) ? nextPriority() : nextRoundRobin();
+
+    if (slot < 0) {
+      break;
+    }
+
+    if (serve (uint8_t (slot))) {
+      read++;
+    }
+  }
+
+  updateRates();
+  return read;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the frame rate of a panel in frames per second, measured over the last
+  complete rate window.
+
+  @param  index The index returned by addPanel().
+*/
+uint16_t CSE_FT6206_Scheduler:: getFrameRate (uint8_t index) {
+  return (index < count) ? slots [index].frameRate : 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames read from a panel since the last reset.
+
+  @param  index The index returned by addPanel().
+*/
+uint32_t CSE_FT6206_Scheduler:: getFrameCount (uint8_t index) {
+  return (index < count) ? slots [index].frames : 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Clears the frame counts and rates and starts a new rate window.
+*/
+void CSE_FT6206_Scheduler:: resetStats (void) {
+  for (uint8_t i = 0; i < count; i++) {
+    slots [i].frames = 0;
+    slots [i].windowFrames = 0;
+    slots [i].frameRate = 0;
+  }
+
+  windowStart = millis();
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the next due panel after the last one read, in the visiting order.
+
+  @returns The slot of the panel, or -1 if no panel is due.
+*/
+int8_t CSE_FT6206_Scheduler:: nextRoundRobin (void) {
+  for (uint8_t k = 0; k < count; k++) {
+    uint8_t position = (cursor + k) % count;
+
+    if (isDue (order [position])) {
+      cursor = (position + 1) % count;
+      return int8_t (order [position]);
+    }
+  }
+
+  return -1;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the due panel with the highest priority. Ties go to the panel that does
+  not need a multiplexer switch, then to the panel that was read least recently.
+
+  @returns The slot of the panel, or -1 if no panel is due.
+*/
+int8_t CSE_FT6206_Scheduler:: nextPriority (void) {
+  int8_t best = -1;
+
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t slot = order [i];
+
+    if (!isDue (slot)) {
+      continue;
+    }
+
+    if (best < 0) {
+      best = int8_t (slot);
+      continue;
+    }
+
+    const CSE_FT6206_PanelSlot &a = slots [slot];
+    const CSE_FT6206_PanelSlot &b = slots [best];
+
+    if (a.priority != b.priority) {
+      if (a.priority > b.priority) {
+        best = int8_t (slot);
+      }
+      continue;
+    }
+
+    bool selectedA = isSelected (slot);
+    bool selectedB = isSelected (uint8_t (best));
+
+    if (selectedA != selectedB) {
+      if (selectedA) {
+        best = int8_t (slot);
+      }
+      continue;
+    }
+
+    if ((int32_t) (a.lastServed - b.lastServed) < 0) {
+      best = int8_t (slot);
+    }
+  }
+
+  return best;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if a panel has a frame to read. Panels in the interrupt mode are
+  due when an interrupt is pending, polled panels are always due.
+*/
+bool CSE_FT6206_Scheduler:: isDue (uint8_t slot) {
+  CSE_FT6206 *panel = slots [slot].panel;
+  return (!panel->isInterruptEnabled()) || panel->isFramePending();
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if a panel can be read without a multiplexer switch.
+*/
+bool CSE_FT6206_Scheduler:: isSelected (uint8_t slot) {
+  CSE_FT6206 *panel = slots [slot].panel;
+  return (panel->getMux() == NULL) || (panel->getMux()->getChannel() == panel->getMuxChannel());
+}
+
+//============================================================================================//
+/**
+  @brief  Reads a frame from a panel and counts it.
+
+  @returns True if a frame was read.
+*/
+bool CSE_FT6206_Scheduler:: serve (uint8_t slot) {
+  CSE_FT6206_PanelSlot &entry = slots [slot];
+  uint32_t seq = entry.panel->getFrameSeq();
+
+  if (entry.panel->isInterruptEnabled()) {
+    entry.panel->service();
+  }
+  else {
+    entry.panel->readData();
+  }
+
+  entry.lastServed = ++tick;
+  uint32_t frames = entry.panel->getFrameSeq() - seq;
+  entry.frames += frames;
+  entry.windowFrames += frames;
+
+  return (frames > 0);
+}
+
+//============================================================================================//
+/**
+  @brief  Computes the frame rates when the rate window is complete.
+*/
+void CSE_FT6206_Scheduler:: updateRates (void) {
+  uint32_t elapsed = millis() - windowStart;
+
+  if (elapsed < FT6206_RATE_WINDOW_MS) {
+    return;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    slots [i].frameRate = uint16_t (((slots [i].windowFrames * 1000UL) + (elapsed / 2)) / elapsed);
+    slots [i].windowFrames = 0;
+  }
+
+  windowStart += elapsed;
+}
+
+//============================================================================================//
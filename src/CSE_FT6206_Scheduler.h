@@ -0,0 +1,84 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Scheduler.h
+  Description: Polling scheduler for multiple panels for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_SCHEDULER_H
+#define CSE_FT6206_SCHEDULER_H
+
+#include "CSE_FT6206_Platform.h"
+
+#define FT6206_SCHEDULER_MAX_PANELS       4     // Number of panels one scheduler can serve
+#define FT6206_RATE_WINDOW_MS             1000  // Window over which the frame rates are measured
+
+// Scheduling modes
+#define FT6206_SCHEDULE_ROUND_ROBIN       0x00  // Due panels are read in turn
+#define FT6206_SCHEDULE_PRIORITY          0x01  // The due panel with the highest priority is read first
+
+class CSE_FT6206;
+
+//============================================================================================//
+/*!
+  @brief  Scheduling state of one panel.
+*/
+struct CSE_FT6206_PanelSlot {
+  CSE_FT6206 *panel;
+  uint8_t priority; // Higher is served first in the priority mode
+  uint32_t lastServed;  // Scheduler tick of the last read, for tie-breaking
+  uint32_t frames;  // Frames read since the last reset
+  uint32_t windowFrames;  // Frames read in the current rate window
+  uint16_t frameRate; // Frames per second over the last rate window
+};
+
+//============================================================================================//
+/*!
+  @brief  Reads frames from several panels. A panel in the built-in interrupt mode is due
+  when it has a pending interrupt and is read with service(). Other panels are always due
+  and are read with readData(). Panels behind the same multiplexer channel are visited
+  one after the other, so that a round trip switches each channel only once. The frame
+  rate of every panel is measured, so that a starved panel can be seen.
+*/
+class CSE_FT6206_Scheduler {
+  public:
+    CSE_FT6206_Scheduler (uint8_t mode = FT6206_SCHEDULE_ROUND_ROBIN);
+
+    int8_t addPanel (CSE_FT6206 *panel, uint8_t priority = 0); // Returns the panel index, -1 if full
+    uint8_t getPanelCount (void);
+    void setMode (uint8_t mode);
+    uint8_t getMode (void);
+
+    uint8_t run (uint8_t budget = 1); // Reads up to budget frames, returns the frames read
+
+    uint16_t getFrameRate (uint8_t index);  // Frames per second over the last rate window
+    uint32_t getFrameCount (uint8_t index);
+    void resetStats (void);
+
+  private:
+    uint8_t mode;
+    uint8_t count;
+    CSE_FT6206_PanelSlot slots [FT6206_SCHEDULER_MAX_PANELS]; // In the order they were added
+    uint8_t order [FT6206_SCHEDULER_MAX_PANELS];  // Visiting order, grouped by multiplexer channel
+    uint8_t cursor; // Position in order of the last panel read in the round-robin mode
+    uint32_t tick;
+    uint32_t windowStart; // millis() at the start of the rate window
+
+    int8_t nextRoundRobin (void);
+    int8_t nextPriority (void);
+    bool isDue (uint8_t slot);
+    bool isSelected (uint8_t slot);
+    bool serve (uint8_t slot);
+    void updateRates (void);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_SCHEDULER_H
@@ -0,0 +1,382 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Trace.cpp
+  Description: Compact binary recorder of raw touch frames for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 07:46:12 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a recorder that keeps the latest frames in a RAM ring. Recording
+  starts with start().
+
+  @param  buffer The ring buffer.
+  @param  size The size of the buffer in bytes, at least FT6206_TRACE_MAX_RECORD.
+*/
+CSE_FT6206_Trace:: CSE_FT6206_Trace (uint8_t *buffer, uint16_t size) {
+  ring = buffer;
+  ringSize = size;
+  writer = NULL;
+  start();
+  recording = false;
+}
+
+//============================================================================================//
+/**
+  @brief  Instantiates a recorder that streams the records to a writer as they are
+  recorded. The header is written with the first frame after start().
+
+  @param  writer The function that receives the bytes.
+*/
+CSE_FT6206_Trace:: CSE_FT6206_Trace (CSE_FT6206_TraceWriter writer) {
+  ring = NULL;
+  ringSize = 0;
+  this->writer = writer;
+  start();
+  recording = false;
+}
+
+//============================================================================================//
+/**
+  @brief  Clears the ring and the counters and starts a new trace.
+*/
+void CSE_FT6206_Trace:: start (void) {
+  head = 0;
+  tail = 0;
+  used = 0;
+  frames = 0;
+  dropped = 0;
+  lastLength = 0;
+  lastTime = 0;
+  baseLength = 0;
+  baseTime = 0;
+  recording = true;
+}
+
+//============================================================================================//
+/**
+  @brief  Stops recording. The ring keeps its frames until the next start().
+*/
+void CSE_FT6206_Trace:: stop (void) {
+  recording = false;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true between start() and stop().
+*/
+bool CSE_FT6206_Trace:: isRecording (void) {
+  return recording;
+}
+
+//============================================================================================//
+/**
+  @brief  Records a frame. In the ring mode, the oldest records are dropped until the new
+  one fits.
+
+  @param  time The micros() timestamp of the frame.
+  @param  raw The register data starting from FT62XX_REG_DEV_MODE.
+  @param  length The number of bytes, 1 to FT6206_TRACE_MAX_FRAME.
+
+  @returns True if the frame was recorded.
+*/
+bool CSE_FT6206_Trace:: record (uint32_t time, const uint8_t *raw, uint8_t length) {
+  if ((!recording) || (length == 0) || (length > FT6206_TRACE_MAX_FRAME)) {
+    return false;
+  }
+
+  uint8_t buffer [FT6206_TRACE_MAX_RECORD];
+  uint32_t delta = (lastLength == 0) ? 0 : (time - lastTime);
+  uint8_t n = encodeRecord (buffer, delta, raw, length, lastRaw, lastLength);
+
+  if (ring == NULL) {
+    if (writer == NULL) {
+      return false;
+    }
+
+    if (lastLength == 0) {
+      uint8_t header [FT6206_TRACE_HEADER_LENGTH];
+      writeHeader (header, time);
+      writer (header, FT6206_TRACE_HEADER_LENGTH);
+    }
+
+    writer (buffer, n);
+  }
+  else {
+    if (n > ringSize) {
+      return false;
+    }
+
+    if (lastLength == 0) {
+      baseTime = time;
+    }
+
+    while ((ringSize - used) < n) {
+      evict();
+    }
+
+    for (uint8_t i = 0; i < n; i++) {
+      ring [head] = buffer [i];
+      head = (head + 1) % ringSize;
+    }
+
+    used += n;
+  }
+
+  memcpy (lastRaw, raw, length);
+  lastLength = length;
+  lastTime = time;
+  frames++;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames in the ring, or the number of frames streamed since
+  start().
+*/
+uint32_t CSE_FT6206_Trace:: getFrameCount (void) {
+  return frames;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames dropped from the ring to make room for new ones
+  since start().
+*/
+uint32_t CSE_FT6206_Trace:: getDroppedCount (void) {
+  return dropped;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of bytes copyTo() and dump() produce, or 0 in the streaming
+  mode.
+*/
+uint32_t CSE_FT6206_Trace:: getLength (void) {
+  return emit (NULL, NULL, 0);
+}
+
+//============================================================================================//
+/**
+  @brief  Copies the frames in the ring into a buffer as a complete trace, which can be
+  read with CSE_FT6206_TraceReader.
+
+  @param  out The buffer.
+  @param  size The size of the buffer.
+
+  @returns The length of the trace, or 0 if it does not fit or in the streaming mode.
+*/
+uint32_t CSE_FT6206_Trace:: copyTo (uint8_t *out, uint32_t size) {
+  uint32_t length = getLength();
+
+  if ((out == NULL) || (length == 0) || (length > size)) {
+    return 0;
+  }
+
+  return emit (NULL, out, size);
+}
+
+//============================================================================================//
+/**
+  @brief  Streams the frames in the ring to a writer as a complete trace.
+
+  @param  writer The function that receives the bytes.
+
+  @returns The length of the trace, or 0 in the streaming mode.
+*/
+uint32_t CSE_FT6206_Trace:: dump (CSE_FT6206_TraceWriter writer) {
+  if (writer == NULL) {
+    return 0;
+  }
+
+  return emit (writer, NULL, 0);
+}
+
+//============================================================================================//
+/**
+  @brief  Encodes a frame as a record. A frame with the same length as the previous one is
+  stored as a repeat if no byte changed, or as the changed bytes if that is shorter.
+
+  @param  out The record buffer, at least FT6206_TRACE_MAX_RECORD bytes.
+  @param  delta The time since the previous frame in microseconds.
+  @param  raw The frame.
+  @param  length The length of the frame, 1 to FT6206_TRACE_MAX_FRAME.
+  @param  previous The previous frame.
+  @param  previousLength The length of the previous frame, 0 if there is none.
+
+  @returns The length of the record.
+*/
+uint8_t CSE_FT6206_Trace:: encodeRecord (uint8_t *out, uint32_t delta, const uint8_t *raw, uint8_t length,
+  const uint8_t *previous, uint8_t previousLength) {
+  uint8_t n = 1;
+  uint8_t type = FT6206_TRACE_FRAME;
+
+  do {
+    uint8_t byte = delta & 0x7F;
+    delta >>= 7;
+    out [n++] = (delta != 0) ? (byte | 0x80) : byte;
+  } while (delta != 0);
+
+  if (length == previousLength) {
+    uint16_t mask = 0;
+    uint8_t changed = 0;
+
+    for (uint8_t i = 0; i < length; i++) {
+      if (raw [i] != previous [i]) {
+        mask |= uint16_t (1) << i;
+        changed++;
+      }
+    }
+
+    if (changed == 0) {
+      type = FT6206_TRACE_REPEAT;
+    }
+    else if ((changed + 2) < length) {
+      type = FT6206_TRACE_DIFF;
+      out [n++] = uint8_t (mask);
+      out [n++] = uint8_t (mask >> 8);
+
+      for (uint8_t i = 0; i < length; i++) {
+        if (mask & (uint16_t (1) << i)) {
+          out [n++] = raw [i];
+        }
+      }
+    }
+  }
+
+  if (type == FT6206_TRACE_FRAME) {
+    memcpy (&out [n], raw, length);
+    n += length;
+  }
+
+  out [0] = uint8_t ((type << 4) | length);
+  return n;
+}
+
+//============================================================================================//
+/**
+  @brief  Drops the oldest record from the ring. The record is decoded into the base frame
+  first, so that the next record can still be decoded.
+*/
+void CSE_FT6206_Trace:: evict (void) {
+  uint32_t delta = 0;
+  uint8_t n = CSE_FT6206_TraceReader:: parseRecord (ring, ringSize, tail, used, baseRaw, baseLength, delta);
+
+  if (n == 0) {
+    // Cannot happen with records written by record(), but never loop forever.
+    tail = head;
+    used = 0;
+    dropped += frames;
+    frames = 0;
+    return;
+  }
+
+  baseTime += delta;
+  tail = (tail + n) % ringSize;
+  used -= n;
+  frames--;
+  dropped++;
+}
+
+//============================================================================================//
+/**
+  @brief  Produces the trace of the ring. The header starts at the time of the base frame,
+  and the oldest record is encoded again as a complete frame, because the reader does not
+  have the base frame. The other records are copied as they are.
+
+  @param  writer The function that receives the bytes, or NULL.
+  @param  out The buffer that receives the bytes if there is no writer, or NULL to only
+  count them.
+  @param  size The size of the buffer.
+
+  @returns The length of the trace, or 0 in the streaming mode.
+*/
+uint32_t CSE_FT6206_Trace:: emit (CSE_FT6206_TraceWriter writer, uint8_t *out, uint32_t size) {
+  if (ring == NULL) {
+    return 0;
+  }
+
+  uint8_t buffer [FT6206_TRACE_MAX_RECORD];
+  uint32_t total = 0;
+
+  writeHeader (buffer, baseTime);
+  total += output (writer, out, size, total, buffer, FT6206_TRACE_HEADER_LENGTH);
+
+  if (used == 0) {
+    return total;
+  }
+
+  uint8_t raw [FT6206_TRACE_MAX_FRAME];
+  uint8_t length = baseLength;
+  uint32_t delta = 0;
+
+  memcpy (raw, baseRaw, baseLength);
+  uint8_t n = CSE_FT6206_TraceReader:: parseRecord (ring, ringSize, tail, used, raw, length, delta);
+  uint8_t first = encodeRecord (buffer, delta, raw, length, NULL, 0);
+  total += output (writer, out, size, total, buffer, first);
+
+  // Copy the rest up to the end of the ring, then from its start.
+  uint16_t position = (tail + n) % ringSize;
+  uint16_t remaining = used - n;
+
+  while (remaining > 0) {
+    uint16_t chunk = ringSize - position;
+    chunk = (chunk > remaining) ? remaining : chunk;
+    chunk = (chunk > 255) ? 255 : chunk;
+    total += output (writer, out, size, total, &ring [position], uint8_t (chunk));
+    position = (position + chunk) % ringSize;
+    remaining -= chunk;
+  }
+
+  return total;
+}
+
+//============================================================================================//
+/**
+  @brief  Sends bytes to the writer, or copies them into the buffer at an offset if they
+  fit.
+
+  @returns The number of bytes.
+*/
+uint8_t CSE_FT6206_Trace:: output (CSE_FT6206_TraceWriter writer, uint8_t *out, uint32_t size, uint32_t offset,
+  const uint8_t *data, uint8_t length) {
+  if (writer != NULL) {
+    writer (data, length);
+  }
+  else if ((out != NULL) && ((offset + length) <= size)) {
+    memcpy (&out [offset], data, length);
+  }
+
+  return length;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes the trace header.
+
+  @param  out The buffer, at least FT6206_TRACE_HEADER_LENGTH bytes.
+  @param  time The micros() timestamp the first time delta is counted from.
+*/
+void CSE_FT6206_Trace:: writeHeader (uint8_t *out, uint32_t time) {
+  out [0] = 'F';
+  out [1] = 'T';
+  out [2] = '6';
+  out [3] = 'T';
+  out [4] = FT6206_TRACE_VERSION;
+  out [5] = uint8_t (time);
+  out [6] = uint8_t (time >> 8);
+  out [7] = uint8_t (time >> 16);
+  out [8] = uint8_t (time >> 24);
+}
+
+//============================================================================================//
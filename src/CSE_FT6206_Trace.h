@@ -0,0 +1,98 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Trace.h
+  Description: Compact binary recorder of raw touch frames for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_TRACE_H
+#define CSE_FT6206_TRACE_H
+
+#include "CSE_FT6206_Platform.h"
+
+// A trace starts with a header of the magic "FT6T", the version and the micros() timestamp
+// the first time delta is counted from (little-endian). Each record then starts with a tag,
+// the record type in the high nibble and the frame length in the low nibble, followed by
+// the time since the previous frame in microseconds as a base-128 varint.
+#define FT6206_TRACE_VERSION              0x01
+#define FT6206_TRACE_HEADER_LENGTH        9   // Magic, version and start time
+#define FT6206_TRACE_MAX_FRAME            15  // Longest frame a record can hold
+#define FT6206_TRACE_MAX_RECORD           23  // Tag, 5 bytes of time delta, 2 bytes of mask and 15 bytes
+
+// Record types
+#define FT6206_TRACE_FRAME                0x00  // The bytes of the frame follow
+#define FT6206_TRACE_REPEAT               0x01  // Same bytes as the previous frame
+#define FT6206_TRACE_DIFF                 0x02  // A 16-bit mask of the changed bytes, then the changed bytes
+
+//============================================================================================//
+/*!
+  @brief  Receives the bytes of a streamed trace, for example to write them to a serial port
+  or to flash.
+*/
+typedef void (*CSE_FT6206_TraceWriter) (const uint8_t *data, uint8_t length);
+
+//============================================================================================//
+/*!
+  @brief  Records the raw register frames read by readData(), with their timestamps, in a
+  compact format. A frame identical to the previous one takes 2 bytes, and a frame where
+  only a coordinate changed takes about 6 bytes instead of 15. The records either go into
+  a RAM ring, where the oldest frames are dropped when it is full, or are streamed to a
+  writer as they are recorded. Traces are replayed with CSE_FT6206_TraceReader.
+*/
+class CSE_FT6206_Trace {
+  public:
+    CSE_FT6206_Trace (uint8_t *buffer, uint16_t size); // Records into a RAM ring
+    CSE_FT6206_Trace (CSE_FT6206_TraceWriter writer); // Streams the records
+
+    void start (void);  // Clears the ring and starts a new trace
+    void stop (void);
+    bool isRecording (void);
+    bool record (uint32_t time, const uint8_t *raw, uint8_t length); // Called by readData()
+
+    uint32_t getFrameCount (void);  // Frames in the ring, or streamed since start()
+    uint32_t getDroppedCount (void);  // Frames dropped from the ring when it was full
+    uint32_t getLength (void);  // Bytes copyTo() and dump() produce
+    uint32_t copyTo (uint8_t *out, uint32_t size);  // Copies the ring as a trace, returns the length or 0
+    uint32_t dump (CSE_FT6206_TraceWriter writer);  // Streams the ring as a trace, returns the length
+
+    static uint8_t encodeRecord (uint8_t *out, uint32_t delta, const uint8_t *raw, uint8_t length,
+      const uint8_t *previous, uint8_t previousLength);
+
+  private:
+    uint8_t *ring;  // NULL in the streaming mode
+    uint16_t ringSize;
+    uint16_t head;  // Where the next record is written
+    uint16_t tail;  // Start of the oldest record
+    uint16_t used;
+    CSE_FT6206_TraceWriter writer;
+    bool recording;
+    uint32_t frames;
+    uint32_t dropped;
+
+    // The last frame recorded, from which the next record is encoded.
+    uint8_t lastRaw [FT6206_TRACE_MAX_FRAME];
+    uint8_t lastLength; // 0 before the first frame
+    uint32_t lastTime;
+
+    // The frame before the oldest record in the ring, from which that record is decoded.
+    uint8_t baseRaw [FT6206_TRACE_MAX_FRAME];
+    uint8_t baseLength;
+    uint32_t baseTime;
+
+    void evict (void);
+    uint32_t emit (CSE_FT6206_TraceWriter writer, uint8_t *out, uint32_t size);
+    static uint8_t output (CSE_FT6206_TraceWriter writer, uint8_t *out, uint32_t size, uint32_t offset,
+      const uint8_t *data, uint8_t length);
+    static void writeHeader (uint8_t *out, uint32_t time);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_TRACE_H
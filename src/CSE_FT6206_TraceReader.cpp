@@ -0,0 +1,205 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_TraceReader.cpp
+  Description: Replay source for touch frame traces for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 07:46:12 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a reader of a trace in memory. Call begin() before reading.
+
+  @param  data The trace.
+  @param  length The length of the trace in bytes.
+*/
+CSE_FT6206_TraceReader:: CSE_FT6206_TraceReader (const uint8_t *data, uint32_t length) {
+  this->data = data;
+  dataLength = length;
+  position = 0;
+  valid = false;
+  frames = 0;
+  time = 0;
+  rawLength = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Checks the header and rewinds to the first frame.
+
+  @returns True if the data starts with a trace header of a supported version.
+*/
+bool CSE_FT6206_TraceReader:: begin (void) {
+  position = 0;
+  frames = 0;
+  rawLength = 0;
+  valid = (data != NULL) && (dataLength >= FT6206_TRACE_HEADER_LENGTH) && (data [0] == 'F') &&
+    (data [1] == 'T') && (data [2] == '6') && (data [3] == 'T') && (data [4] == FT6206_TRACE_VERSION);
+
+  if (!valid) {
+    return false;
+  }
+
+  time = uint32_t (data [5]) | (uint32_t (data [6]) << 8) | (uint32_t (data [7]) << 16) | (uint32_t (data [8]) << 24);
+  position = FT6206_TRACE_HEADER_LENGTH;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Reads the next frame.
+
+  @param  time Receives the micros() timestamp of the frame when it was recorded.
+  @param  raw Receives the register data, at least FT6206_TRACE_MAX_FRAME bytes.
+  @param  length Receives the number of bytes.
+
+  @returns True if a frame was read, false at the end of the trace or if the record is
+  malformed. Reading stops at a malformed record.
+*/
+bool CSE_FT6206_TraceReader:: next (uint32_t &time, uint8_t *raw, uint8_t &length) {
+  if ((!valid) || (position >= dataLength)) {
+    return false;
+  }
+
+  uint32_t delta = 0;
+  uint8_t n = parseRecord (data, dataLength, position, dataLength - position, this->raw, rawLength, delta);
+
+  if (n == 0) {
+    valid = false;
+    return false;
+  }
+
+  position += n;
+  this->time += delta;
+  frames++;
+
+  time = this->time;
+  memcpy (raw, this->raw, rawLength);
+  length = rawLength;
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of frames read since begin().
+*/
+uint32_t CSE_FT6206_TraceReader:: getFrameCount (void) {
+  return frames;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns true if the whole trace was read without a malformed record.
+*/
+bool CSE_FT6206_TraceReader:: isComplete (void) {
+  return valid && (position == dataLength);
+}
+
+//============================================================================================//
+/**
+  @brief  Decodes one record onto the previous frame. The record may wrap around the end
+  of the data, so that the same parser serves the ring of the recorder.
+
+  @param  data The records.
+  @param  size The size of the data, after which the record continues at its start.
+  @param  start The offset of the record.
+  @param  available The number of bytes from the offset that belong to records.
+  @param  raw The previous frame, replaced by the decoded frame. At least
+  FT6206_TRACE_MAX_FRAME bytes.
+  @param  length The length of the previous frame, replaced by the decoded length.
+  @param  delta Receives the time since the previous frame in microseconds.
+
+  @returns The length of the record, or 0 if it is truncated or malformed. The frame is
+  not changed then.
+*/
+uint8_t CSE_FT6206_TraceReader:: parseRecord (const uint8_t *data, uint32_t size, uint32_t start, uint32_t available,
+  uint8_t *raw, uint8_t &length, uint32_t &delta) {
+  uint8_t record [FT6206_TRACE_MAX_RECORD];
+  uint8_t limit = (available < FT6206_TRACE_MAX_RECORD) ? uint8_t (available) : FT6206_TRACE_MAX_RECORD;
+
+  // Gather the bytes that can belong to the record, unwrapping the ring.
+  for (uint8_t i = 0; i < limit; i++) {
+    uint32_t index = start + i;
+    record [i] = data [(index >= size) ? (index - size) : index];
+  }
+
+  if (limit < 2) {
+    return 0;
+  }
+
+  uint8_t type = record [0] >> 4;
+  uint8_t count = record [0] & 0x0F;
+  uint8_t n = 1;
+  uint32_t value = 0;
+
+  for (uint8_t shift = 0; ; shift += 7) {
+    if ((n >= limit) || (shift > 28)) {
+      return 0;
+    }
+
+    uint8_t byte = record [n++];
+    value |= uint32_t (byte & 0x7F) << shift;
+
+    if ((byte & 0x80) == 0) {
+      break;
+    }
+  }
+
+  if (type == FT6206_TRACE_FRAME) {
+    if ((count == 0) || ((n + count) > limit)) {
+      return 0;
+    }
+
+    memcpy (raw, &record [n], count);
+    n += count;
+    length = count;
+  }
+  else if (type == FT6206_TRACE_REPEAT) {
+    if ((count == 0) || (count != length)) {
+      return 0;
+    }
+  }
+  else if (type == FT6206_TRACE_DIFF) {
+    if ((count == 0) || (count != length) || ((n + 2) > limit)) {
+      return 0;
+    }
+
+    uint16_t mask = uint16_t (record [n]) | (uint16_t (record [n + 1]) << 8);
+    uint8_t changed = 0;
+    n += 2;
+
+    if ((mask >> count) != 0) {
+      return 0;
+    }
+
+    for (uint16_t bits = mask; bits != 0; bits &= (bits - 1)) {
+      changed++;
+    }
+
+    if ((n + changed) > limit) {
+      return 0;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+      if (mask & (uint16_t (1) << i)) {
+        raw [i] = record [n++];
+      }
+    }
+  }
+  else {
+    return 0;
+  }
+
+  delta = value;
+  return n;
+}
+
+//============================================================================================//
@@ -0,0 +1,53 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_TraceReader.h
+  Description: Replay source for touch frame traces for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_TRACE_READER_H
+#define CSE_FT6206_TRACE_READER_H
+
+#include "CSE_FT6206_Platform.h"
+#include "CSE_FT6206_Trace.h"
+
+//============================================================================================//
+/*!
+  @brief  Reads the frames of a trace recorded by CSE_FT6206_Trace, in order and with their
+  original timestamps. Pass the reader to CSE_FT6206::replay() to feed the frames through
+  the same decoding and processing as readData(), without the bus and as fast as the host
+  can run, so that the output is the same on every run.
+*/
+class CSE_FT6206_TraceReader {
+  public:
+    CSE_FT6206_TraceReader (const uint8_t *data, uint32_t length);
+
+    bool begin (void);  // Checks the header and rewinds, false if the data is not a trace
+    bool next (uint32_t &time, uint8_t *raw, uint8_t &length);  // Reads the next frame, false at the end
+    uint32_t getFrameCount (void);  // Frames read since begin()
+    bool isComplete (void); // True if every record was read and none was malformed
+
+    static uint8_t parseRecord (const uint8_t *data, uint32_t size, uint32_t start, uint32_t available,
+      uint8_t *raw, uint8_t &length, uint32_t &delta);
+
+  private:
+    const uint8_t *data;
+    uint32_t dataLength;
+    uint32_t position;
+    bool valid;
+    uint32_t frames;
+    uint32_t time;
+    uint8_t raw [FT6206_TRACE_MAX_FRAME]; // The last frame read, from which the next record is decoded
+    uint8_t rawLength;
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_TRACE_READER_H
@@ -0,0 +1,327 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Tracker.cpp
+  Description: Per-finger touch tracking and event generation for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:48:19 PM 16-10-2026, Friday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Instantiates a new tracker.
+*/
+CSE_FT6206_Tracker:: CSE_FT6206_Tracker() {
+  callback = NULL;
+  moveThreshold = FT6206_DEFAULT_MOVE_THRESHOLD;
+  swapDistance = FT6206_DEFAULT_SWAP_DISTANCE;
+  reset();
+}
+
+//============================================================================================//
+/**
+  @brief  Drops all tracks and buffered events without emitting any events.
+*/
+void CSE_FT6206_Tracker:: reset (void) {
+  for (uint8_t i = 0; i < FT6206_MAX_TOUCH_POINTS; i++) {
+    tracks [i].active = false;
+    tracks [i].id = 0;
+    tracks [i].hwId = 0;
+    tracks [i].x = 0;
+    tracks [i].y = 0;
+    tracks [i].downTime = 0;
+  }
+
+  nextId = 0;
+  eventHead = 0;
+  eventCount = 0;
+  droppedEvents = 0;
+}
+
+//============================================================================================//
+/**
+  @brief  Matches the points of a frame to the tracks and emits the events.
+
+  Only points that are in contact (touch-down or contact state) are matched. A point first
+  matches the track with the same hardware ID, unless that track is further than the swap
+  distance, in which case the nearest unmatched track is used. Unmatched points start new
+  tracks. Unmatched tracks end with an up event if the controller reported a lift-up, or a
+  cancel event if the finger just disappeared.
+
+  @param  frame The decoded frame.
+*/
+void CSE_FT6206_Tracker:: update (const CSE_FT6206_Frame &frame) {
+  int8_t match [FT6206_MAX_TOUCH_POINTS]; // Track slot of each point, -1 if none
+  bool contact [FT6206_MAX_TOUCH_POINTS];
+  bool matched [FT6206_MAX_TOUCH_POINTS]; // Track slots already matched
+  uint32_t swapSq = uint32_t (swapDistance) * swapDistance;
+
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    uint8_t state = frame.points [p].state;
+    contact [p] = (p < frame.touches) && ((state == FT62XX_TOUCH_DOWN) || (state == FT62XX_TOUCH_CONTACT));
+    match [p] = -1;
+    matched [p] = false;
+  }
+
+  // First pass: match by hardware ID when the track is close enough.
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    if (!contact [p]) {
+      continue;
+    }
+
+    for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+      if ((!tracks [t].active) || matched [t] || (tracks [t].hwId != frame.points [p].id)) {
+        continue;
+      }
+
+      if (distanceSq (tracks [t].x, tracks [t].y, frame.points [p].x, frame.points [p].y) <= swapSq) {
+        match [p] = t;
+        matched [t] = true;
+      }
+      break;
+    }
+  }
+
+  // Second pass: match the remaining points to the nearest unmatched track.
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    if ((!contact [p]) || (match [p] >= 0)) {
+      continue;
+    }
+
+    uint32_t best = 0xFFFFFFFFUL;
+
+    for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+      if ((!tracks [t].active) || matched [t]) {
+        continue;
+      }
+
+      uint32_t d = distanceSq (tracks [t].x, tracks [t].y, frame.points [p].x, frame.points [p].y);
+
+      if (d < best) {
+        best = d;
+        match [p] = t;
+      }
+    }
+
+    if (match [p] >= 0) {
+      matched [match [p]] = true;
+    }
+  }
+
+  // Tracks without a point have ended.
+  for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+    if ((!tracks [t].active) || matched [t]) {
+      continue;
+    }
+
+    uint8_t type = FT6206_EVENT_CANCEL;
+
+    for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+      if ((frame.points [p].state == FT62XX_TOUCH_UP) && (frame.points [p].id == tracks [t].hwId)) {
+        tracks [t].x = frame.points [p].x;
+        tracks [t].y = frame.points [p].y;
+        type = FT6206_EVENT_UP;
+        break;
+      }
+    }
+
+    tracks [t].active = false;
+    emit (type, tracks [t], frame.timestamp);
+  }
+
+  // Matched points move their tracks, unmatched points start new tracks.
+  for (uint8_t p = 0; p < FT6206_MAX_TOUCH_POINTS; p++) {
+    if (!contact [p]) {
+      continue;
+    }
+
+    const CSE_TouchPoint &point = frame.points [p];
+
+    if (match [p] >= 0) {
+      CSE_FT6206_Track &track = tracks [match [p]];
+      int16_t dx = point.x - track.x;
+      int16_t dy = point.y - track.y;
+      track.hwId = point.id;
+
+      if ((abs (dx) >= moveThreshold) || (abs (dy) >= moveThreshold)) {
+        track.x = point.x;
+        track.y = point.y;
+        emit (FT6206_EVENT_MOVE, track, frame.timestamp);
+      }
+      continue;
+    }
+
+    for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+      if (tracks [t].active) {
+        continue;
+      }
+
+      CSE_FT6206_Track &track = tracks [t];
+      track.active = true;
+      track.id = nextId++;
+      track.hwId = point.id;
+      track.x = point.x;
+      track.y = point.y;
+      track.downTime = frame.timestamp;
+      emit (FT6206_EVENT_DOWN, track, frame.timestamp);
+      break;
+    }
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Ends all active tracks with cancel events. Use this when frames were lost, for
+  example after a bus error, and the state of the fingers is unknown.
+
+  @param  timestamp The timestamp of the cancel events.
+*/
+void CSE_FT6206_Tracker:: cancelAll (uint32_t timestamp) {
+  for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+    if (tracks [t].active) {
+      tracks [t].active = false;
+      emit (FT6206_EVENT_CANCEL, tracks [t], timestamp);
+    }
+  }
+}
+
+//============================================================================================//
+/**
+  @brief  Sets a function to receive the events. Events are delivered from the context that
+  reads the frames, and are not queued while a callback is set. Pass NULL to use the queue.
+
+  @param  callback The event callback.
+*/
+void CSE_FT6206_Tracker:: setCallback (CSE_FT6206_EventCallback callback) {
+  this->callback = callback;
+}
+
+//============================================================================================//
+/**
+  @brief  Removes the oldest event from the queue.
+
+  @param  event The event to copy the data to.
+
+  @returns True if an event was removed, false if the queue was empty.
+*/
+bool CSE_FT6206_Tracker:: popEvent (CSE_FT6206_TouchEvent &event) {
+  if (eventCount == 0) {
+    return false;
+  }
+
+  uint8_t tail = (eventHead + FT6206_EVENT_QUEUE_SIZE - eventCount) % FT6206_EVENT_QUEUE_SIZE;
+  event = events [tail];
+  eventCount--;
+
+  return true;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of events in the queue.
+*/
+uint8_t CSE_FT6206_Tracker:: availableEvents (void) {
+  return eventCount;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of events dropped because the queue was full. The oldest event
+  is dropped first.
+*/
+uint32_t CSE_FT6206_Tracker:: getDroppedEvents (void) {
+  return droppedEvents;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the minimum movement along either axis for a move event.
+
+  @param  pixels The threshold in pixels.
+*/
+void CSE_FT6206_Tracker:: setMoveThreshold (uint8_t pixels) {
+  moveThreshold = (pixels == 0) ? 1 : pixels;
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the distance beyond which a point with the same hardware ID as a track is
+  not trusted to be the same finger, and nearest neighbour matching is used instead.
+
+  @param  pixels The distance in pixels.
+*/
+void CSE_FT6206_Tracker:: setSwapDistance (uint16_t pixels) {
+  swapDistance = pixels;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the number of active tracks.
+*/
+uint8_t CSE_FT6206_Tracker:: getActiveCount (void) {
+  uint8_t count = 0;
+
+  for (uint8_t t = 0; t < FT6206_MAX_TOUCH_POINTS; t++) {
+    count += tracks [t].active ? 1 : 0;
+  }
+
+  return count;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns a track slot, or NULL if the slot is invalid.
+*/
+const CSE_FT6206_Track *CSE_FT6206_Tracker:: getTrack (uint8_t slot) {
+  if (slot >= FT6206_MAX_TOUCH_POINTS) {
+    return NULL;
+  }
+
+  return &tracks [slot];
+}
+
+//============================================================================================//
+/**
+  @brief  Delivers an event to the callback, or adds it to the queue.
+*/
+void CSE_FT6206_Tracker:: emit (uint8_t type, const CSE_FT6206_Track &track, uint32_t timestamp) {
+  CSE_FT6206_TouchEvent event;
+  event.type = type;
+  event.id = track.id;
+  event.x = track.x;
+  event.y = track.y;
+  event.timestamp = timestamp;
+
+  if (callback != NULL) {
+    callback (event);
+    return;
+  }
+
+  if (eventCount >= FT6206_EVENT_QUEUE_SIZE) {
+    eventCount--; // Drop the oldest event
+    droppedEvents++;
+  }
+
+  events [eventHead] = event;
+  eventHead = (eventHead + 1) % FT6206_EVENT_QUEUE_SIZE;
+  eventCount++;
+}
+
+//============================================================================================//
+
+uint32_t CSE_FT6206_Tracker:: distanceSq (int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+  int32_t dx = int32_t (x1) - x2;
+  int32_t dy = int32_t (y1) - y2;
+
+  return uint32_t (dx * dx) + uint32_t (dy * dy);
+}
+
+//============================================================================================//
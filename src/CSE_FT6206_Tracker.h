@@ -0,0 +1,105 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Tracker.h
+  Description: Per-finger touch tracking and event generation for the CSE_FT6206 Arduino
+  library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_TRACKER_H
+#define CSE_FT6206_TRACKER_H
+
+#include "CSE_FT6206_Platform.h"
+#include "CSE_FT6206_FrameQueue.h"
+
+#define FT6206_EVENT_QUEUE_SIZE           8 // Number of events buffered by the tracker
+
+// Touch event types
+#define FT6206_EVENT_DOWN                 0x00  // A finger landed
+#define FT6206_EVENT_MOVE                 0x01  // A finger moved
+#define FT6206_EVENT_UP                   0x02  // A finger lifted
+#define FT6206_EVENT_CANCEL               0x03  // A finger disappeared without a lift-up
+
+#define FT6206_DEFAULT_MOVE_THRESHOLD     1   // Minimum movement in pixels for a move event
+#define FT6206_DEFAULT_SWAP_DISTANCE      40  // Distance in pixels beyond which a hardware ID match is not trusted
+
+//============================================================================================//
+/*!
+  @brief  A touch event. The ID is assigned when a finger lands and stays the same until
+  it lifts, even if the controller swaps its hardware IDs.
+*/
+struct CSE_FT6206_TouchEvent {
+  uint8_t type; // One of FT6206_EVENT_*
+  uint8_t id; // Track ID
+  int16_t x;
+  int16_t y;
+  uint32_t timestamp; // micros() timestamp of the frame
+};
+
+typedef void (*CSE_FT6206_EventCallback) (const CSE_FT6206_TouchEvent &event);
+
+//============================================================================================//
+/*!
+  @brief  One tracked finger.
+*/
+struct CSE_FT6206_Track {
+  bool active;
+  uint8_t id; // Track ID reported in the events
+  uint8_t hwId; // Hardware ID nibble of the last matched point
+  int16_t x;
+  int16_t y;
+  uint32_t downTime;  // Timestamp of the touch-down
+};
+
+//============================================================================================//
+/*!
+  @brief  Keeps persistent tracks of the fingers across frames and emits events only when
+  a finger lands, moves, lifts or disappears. Points are matched to tracks by their hardware
+  ID, and by nearest neighbour when the ID match is far away (the controller swapped IDs).
+  Events go to the callback if one is set, otherwise to an internal queue.
+*/
+class CSE_FT6206_Tracker {
+  public:
+    CSE_FT6206_Tracker();
+
+    void update (const CSE_FT6206_Frame &frame);  // Consumes a decoded frame
+    void cancelAll (uint32_t timestamp);  // Emits cancel events for all active tracks
+    void reset (void);  // Drops all tracks and events without emitting events
+
+    void setCallback (CSE_FT6206_EventCallback callback);
+    bool popEvent (CSE_FT6206_TouchEvent &event); // Never blocks, returns false if empty
+    uint8_t availableEvents (void);
+    uint32_t getDroppedEvents (void);
+
+    void setMoveThreshold (uint8_t pixels = FT6206_DEFAULT_MOVE_THRESHOLD);
+    void setSwapDistance (uint16_t pixels = FT6206_DEFAULT_SWAP_DISTANCE);
+
+    uint8_t getActiveCount (void);
+    const CSE_FT6206_Track *getTrack (uint8_t slot);
+
+  private:
+    CSE_FT6206_Track tracks [FT6206_MAX_TOUCH_POINTS];
+    uint8_t nextId;
+    uint8_t moveThreshold;
+    uint16_t swapDistance;
+
+    CSE_FT6206_EventCallback callback;
+    CSE_FT6206_TouchEvent events [FT6206_EVENT_QUEUE_SIZE];
+    uint8_t eventHead;
+    uint8_t eventCount;
+    uint32_t droppedEvents;
+
+    void emit (uint8_t type, const CSE_FT6206_Track &track, uint32_t timestamp);
+    static uint32_t distanceSq (int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_TRACKER_H
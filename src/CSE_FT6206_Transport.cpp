@@ -0,0 +1,48 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Transport.cpp
+  Description: I2C transport interface of the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+//============================================================================================//
+/**
+  @brief  Starts a register read that runs in the background. The buffer must stay valid
+  until getReadStatus() reports the end. The default does not start anything, so that
+  blocking backends need not implement it.
+
+  @param  address The 7-bit device address.
+  @param  reg The first register.
+  @param  buffer Receives the values.
+  @param  length The number of registers.
+
+  @returns True if the read was started, false if the backend can only read blocking.
+*/
+bool CSE_FT6206_Transport:: startRead (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) {
+  (void) address;
+  (void) reg;
+  (void) buffer;
+  (void) length;
+  return false;
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the state of the read started by startRead(). Must not block.
+
+  @returns FT6206_I2C_PENDING while the read runs, then FT6206_I2C_OK or the error.
+*/
+uint8_t CSE_FT6206_Transport:: getReadStatus (void) {
+  return FT6206_I2C_BUS_ERROR;
+}
+
+//============================================================================================//
@@ -0,0 +1,50 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_Transport.h
+  Description: I2C transport interface of the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 01:46:30 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_TRANSPORT_H
+#define CSE_FT6206_TRANSPORT_H
+
+#include "CSE_FT6206_Platform.h"
+
+//============================================================================================//
+/*!
+  @brief  The register transfers the driver needs from an I2C bus. A backend performs a
+  whole register read or write, so that it can use the cheapest form its bus offers, and
+  reports the result as one of FT6206_I2C_*. Retries, statistics and the multiplexer are
+  handled by the driver. A write of no registers sends the register address alone, which
+  the multiplexer uses to write its control byte.
+
+  A backend that can run a read in the background, with interrupts or DMA, also overrides
+  startRead() and getReadStatus(). The driver then uses them for its split-phase reads, see
+  CSE_FT6206::startRead(). The defaults report no support, and the driver reads blocking.
+  The driver gives up on a read that stays pending for FT6206_READ_TIMEOUT_US and starts it
+  again, so startRead() must also accept a new read while the previous one is pending.
+*/
+class CSE_FT6206_Transport {
+  public:
+    virtual ~CSE_FT6206_Transport() {}
+
+    virtual void begin (void) = 0;  // Starts the bus, also called to restart it after a recovery
+    virtual void setClock (uint32_t clock) = 0; // Bus clock in Hz, where the backend can set it
+    virtual uint8_t probe (uint8_t address) = 0;  // Addresses the device without data
+    virtual uint8_t readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) = 0;
+    virtual uint8_t writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length) = 0;
+
+    virtual bool startRead (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length); // Starts a background read, false if not supported
+    virtual uint8_t getReadStatus (void); // FT6206_I2C_PENDING until the started read ends
+};
+
+//============================================================================================//
+
+#endif // CSE_FT6206_TRANSPORT_H
@@ -0,0 +1,154 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_WireTransport.cpp
+  Description: Arduino TwoWire transport for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#include "CSE_FT6206.h"
+
+#if !defined (CSE_FT6206_POSIX)
+
+//============================================================================================//
+/**
+  @brief  Instantiates a transport over a TwoWire bus.
+
+  @param  i2c The bus.
+*/
+CSE_FT6206_WireTransport:: CSE_FT6206_WireTransport (TwoWire *i2c) {
+  wireInstance = i2c;
+}
+
+//============================================================================================//
+/**
+  @brief  Starts the I2C peripheral.
+*/
+void CSE_FT6206_WireTransport:: begin (void) {
+  wireInstance->begin();
+}
+
+//============================================================================================//
+/**
+  @brief  Sets the bus clock.
+
+  @param  clock The clock in Hz.
+*/
+void CSE_FT6206_WireTransport:: setClock (uint32_t clock) {
+  wireInstance->setClock (clock);
+}
+
+//============================================================================================//
+/**
+  @brief  Sends the address of a device without data.
+
+  @returns FT6206_I2C_OK if the device acknowledged, or the error.
+*/
+uint8_t CSE_FT6206_WireTransport:: probe (uint8_t address) {
+  wireInstance->beginTransmission (address);
+  return statusError (wireInstance->endTransmission());
+}
+
+//============================================================================================//
+/**
+  @brief  Reads consecutive registers in one combined transfer: the register address is
+  written without a STOP, and the data is read after a repeated START. Everything that
+  arrives is drained, so that no stale bytes are left for the next read.
+
+  @param  address The 7-bit device address.
+  @param  reg The first register.
+  @param  buffer Receives the values.
+  @param  length The number of registers.
+
+  @returns FT6206_I2C_OK, or the error.
+*/
+uint8_t CSE_FT6206_WireTransport:: readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length) {
+  wireInstance->beginTransmission (address);
+  wireInstance->write (byte (reg));
+  uint8_t status = wireInstance->endTransmission (false);
+
+  if (status != 0) {
+    return statusError (status);
+  }
+
+  uint8_t received = wireInstance->requestFrom (byte (address), byte (length));
+  uint8_t count = 0;
+
+  while (wireInstance->available()) {
+    uint8_t value = wireInstance->read();
+
+    if (count < length) {
+      buffer [count++] = value;
+    }
+  }
+
+  if (received == 0) {
+    return FT6206_I2C_ADDRESS_NACK;
+  }
+
+  return (count < length) ? FT6206_I2C_SHORT_READ : FT6206_I2C_OK;
+}
+
+//============================================================================================//
+/**
+  @brief  Writes consecutive registers with one auto-increment write.
+
+  @param  address The 7-bit device address.
+  @param  reg The first register.
+  @param  buffer The values.
+  @param  length The number of registers.
+
+  @returns FT6206_I2C_OK, or the error.
+*/
+uint8_t CSE_FT6206_WireTransport:: writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length) {
+  wireInstance->beginTransmission (address);
+  wireInstance->write (byte (reg));
+
+  for (uint8_t i = 0; i < length; i++) {
+    wireInstance->write (byte (buffer [i]));
+  }
+
+  return statusError (wireInstance->endTransmission());
+}
+
+//============================================================================================//
+/**
+  @brief  Returns the bus.
+*/
+TwoWire *CSE_FT6206_WireTransport:: getWire (void) {
+  return wireInstance;
+}
+
+//============================================================================================//
+/**
+  @brief  Converts an endTransmission() status to an error. The Arduino cores return 2 for
+  an address NACK and 3 for a data NACK. 1 (buffer overflow), 4 (other error) and 5
+  (timeout, where supported) are bus errors.
+
+  @returns One of FT6206_I2C_*.
+*/
+uint8_t CSE_FT6206_WireTransport:: statusError (uint8_t status) {
+  switch (status) {
+    case 0:
+      return FT6206_I2C_OK;
+
+    case 2:
+      return FT6206_I2C_ADDRESS_NACK;
+
+    case 3:
+      return FT6206_I2C_DATA_NACK;
+
+    default:
+      return FT6206_I2C_BUS_ERROR;
+  }
+}
+
+#endif // CSE_FT6206_POSIX
+
+//============================================================================================//
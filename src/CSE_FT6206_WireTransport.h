@@ -0,0 +1,52 @@
+//============================================================================================//
+/*
+  Filename: CSE_FT6206_WireTransport.h
+  Description: Arduino TwoWire transport for the CSE_FT6206 Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.3
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_FT6206
+  Last Modified: +05:30 12:31:48 AM 17-10-2026, Saturday
+ */
+//============================================================================================//
+
+#ifndef CSE_FT6206_WIRE_TRANSPORT_H
+#define CSE_FT6206_WIRE_TRANSPORT_H
+
+#include "CSE_FT6206_Transport.h"
+
+#if !defined (CSE_FT6206_POSIX)
+
+#include <Wire.h>
+
+//============================================================================================//
+/*!
+  @brief  Transport over an Arduino TwoWire bus. A register read writes the register
+  address without a STOP and reads the data after a repeated START, so that no other
+  master can take the bus between the two and one STOP is saved.
+*/
+class CSE_FT6206_WireTransport : public CSE_FT6206_Transport {
+  public:
+    CSE_FT6206_WireTransport (TwoWire *i2c = &Wire);
+
+    void begin (void);
+    void setClock (uint32_t clock);
+    uint8_t probe (uint8_t address);
+    uint8_t readRegisters (uint8_t address, uint8_t reg, uint8_t *buffer, uint8_t length);
+    uint8_t writeRegisters (uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t length);
+
+    TwoWire *getWire (void);
+
+    static uint8_t statusError (uint8_t status); // endTransmission() status to FT6206_I2C_*
+
+  private:
+    TwoWire *wireInstance;
+};
+
+#endif // CSE_FT6206_POSIX
+
+//============================================================================================//
+
+#endif // CSE_FT6206_WIRE_TRANSPORT_H